@@ -0,0 +1,70 @@
+"use strict";
+
+// Benchmarks recovery computation (GF matrix multiplication) in isolation, comparing the cache tiled scheduler against processing all inputs per output
+// Usage: node gfmat.js [sliceSize=1048576] [inputs=1000] [outputs=100] [method=0] [threads=0] [batch=0]
+//   batch: number of inputs submitted per generate call (0 = all)
+
+var gf = require('../build/Release/parpar_gf.node');
+
+var opts = {
+	sliceSize: 1048576,
+	inputs: 1000,
+	outputs: 100,
+	method: 0,
+	threads: 0,
+	batch: 0
+};
+process.argv.slice(2).forEach(function(arg) {
+	var m = arg.match(/^(\w+)=(\d+)$/);
+	if(!m || !(m[1] in opts)) {
+		console.error('Invalid argument: ' + arg);
+		process.exit(1);
+	}
+	opts[m[1]] = m[2] | 0;
+});
+
+var info = gf.set_method(opts.method, opts.sliceSize);
+if(opts.threads && gf.set_max_threads) gf.set_max_threads(opts.threads);
+var len = Math.ceil(opts.sliceSize / info.stride) * info.stride;
+var batch = opts.batch || opts.inputs;
+
+var alignedBuffer = function(len) {
+	var buf = Buffer.alloc(len + info.alignment);
+	var ao = gf.alignment_offset(buf);
+	if(ao) ao = info.alignment - ao;
+	return buf.slice(ao, ao + len);
+};
+
+var input = alignedBuffer(len * batch);
+var data = require('crypto').pseudoRandomBytes(opts.sliceSize);
+for(var i=0; i<batch; i++)
+	gf.copy_packed(data, input, len, i, batch);
+var outputs = [], oNums = [];
+for(var i=0; i<opts.outputs; i++) {
+	outputs.push(alignedBuffer(len));
+	oNums.push(i);
+}
+var iNums = [];
+for(var i=0; i<batch; i++)
+	iNums.push(i);
+
+console.log('Method: ' + info.method_desc + ', threads: ' + gf.get_num_threads());
+console.log('Slice size: ' + opts.sliceSize + ', inputs: ' + opts.inputs + ' (batch ' + batch + '), outputs: ' + opts.outputs);
+
+var run = function(tiling) {
+	gf.set_tiling(tiling);
+	var start = process.hrtime();
+	for(var i=0; i<opts.inputs; i+=batch)
+		gf.generate_packed(input, len, batch, iNums.slice(0, Math.min(batch, opts.inputs-i)), outputs, oNums, i > 0);
+	var time = process.hrtime(start);
+	time = time[0] + time[1]/1e9;
+	var size = opts.sliceSize * opts.inputs;
+	console.log((tiling ? 'Tiled:     ' : 'Non-tiled: ') + time.toFixed(3) + 's (' + (size / 1048576 / time).toFixed(1) + ' MB/s input)');
+};
+
+// warm up, then alternate a few times
+run(true);
+for(var round=0; round<2; round++) {
+	run(false);
+	run(true);
+}
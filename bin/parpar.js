@@ -143,6 +143,10 @@ var opts = {
 		type: 'size',
 		map: 'seqReadSize'
 	},
+	'read-concurrency': {
+		type: 'int',
+		map: 'readConcurrency'
+	},
 	/*'seq-first-pass': {
 		type: 'bool',
 		map: 'noChunkFirstPass'
@@ -401,8 +405,6 @@ var inputFiles = argv._;
 	var decimalPoint = (1.1).toLocaleString().substr(1, 1);
 
 	if(argv.threads) {
-		if(!ParPar.setMaxThreads)
-			error('This build of ParPar has not been compiled with OpenMP support, which is required for multi-threading support');
 		ParPar.setMaxThreads(argv.threads);
 	}
 	//if(argv.method == 'auto') argv.method = '';
@@ -419,10 +421,22 @@ var inputFiles = argv._;
 			process.exit(1);
 		}
 		
-		ParPar.setMethod(argv.method || '', inputSliceDef.unit == 'count' ? 0 : inputSliceDef.value); // TODO: allow size hint to work if slice-count is specified + consider min/max limits
+		var tune = (argv.method == 'tune');
+		try {
+			ParPar.setMethod(tune ? '' : argv.method || '', inputSliceDef.unit == 'count' ? 0 : inputSliceDef.value); // TODO: allow size hint to work if slice-count is specified + consider min/max limits
+		} catch(x) {
+			error(x.message);
+		}
 		var g;
 		try {
 			g = new ParPar.PAR2Gen(info, inputSliceCount, ppo);
+			if(tune) {
+				// benchmark using the parameters selected for this job, then set it up again with the fastest method
+				if(!argv.quiet) process.stderr.write('Tuning GF method, this may take a while...\n');
+				var tuneResults = ParPar.autotune(g._chunkSize, Math.min(g.opts.processBatchSize, g.inputSlices), g.opts.recoverySlices);
+				if(!argv.quiet) process.stderr.write('Fastest: ' + tuneResults[0].method + ' (' + (tuneResults[0].speed/1048576).toFixed(1) + ' MB/s)\n');
+				g = new ParPar.PAR2Gen(info, inputSliceCount, ppo);
+			}
 		} catch(x) {
 			error(x.message);
 		}
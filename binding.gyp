@@ -37,47 +37,135 @@
   "targets": [
     {
       "target_name": "parpar_gf",
-      "dependencies": ["gf16", "gf16_sse2", "gf16_ssse3", "gf16_avx", "gf16_avx2", "gf16_avx512", "gf16_vbmi", "gf16_gfni", "gf16_gfni_avx2", "gf16_gfni_avx512", "gf16_neon", "gf16_sve", "gf16_sve2", "multi_md5"],
-      "sources": ["src/gf.cc", "gf16/module.cc", "gf16/gfmat_coeff.c", "src/gyp_warnings.cc"],
-      "include_dirs": ["gf16"],
+      "dependencies": ["gf16", "gf16_sse2", "gf16_ssse3", "gf16_avx", "gf16_avx2", "gf16_avx512", "gf16_vbmi", "gf16_gfni", "gf16_gfni_avx2", "gf16_gfni_avx512", "gf16_neon", "gf16_sve", "gf16_sve2", "multi_md5", "multi_md5_avx2", "multi_md5_avx512", "multi_md5_neon", "crc32", "crc32_clmul", "crc32_vclmul", "crc32_arm"],
+      "sources": ["src/gf.cc", "gf16/module.cc", "gf16/gfmat_coeff.c", "src/threadpool.cc", "src/gyp_warnings.cc"],
+      "include_dirs": ["gf16"]
+    },
+    {
+      "target_name": "multi_md5",
+      "type": "static_library",
+      "sources": ["md5/md5.c", "md5/md5-simd.c", "md5/md5x2.c"],
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "cxxflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "xcode_settings": {
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+        "OTHER_CXXFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}}
+    },
+    {
+      "target_name": "multi_md5_avx2",
+      "type": "static_library",
+      "sources": ["md5/md5-avx2.c"],
+      "cflags": ["-Wno-unused-function"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
       "conditions": [
-        ['OS=="win"', {
-          "msvs_settings": {"VCCLCompilerTool": {"OpenMP": "true"}}
-        }, {
-          "variables": {
-            "supports_omp%": "<!(<!(echo ${CXX_target:-${CXX:-c++}}) -MM -E src/gyp_warnings.cc -fopenmp 2>/dev/null || true)",
-            "supports_omp_icc%": "<!(<!(echo ${CXX_target:-${CXX:-c++}}) -MM -E src/gyp_warnings.cc -qopenmp 2>/dev/null || true)",
-            "supports_omp_clang%": "<!(<!(echo ${CXX_target:-${CXX:-c++}}) -MM -E src/gyp_warnings.cc -fopenmp=libomp 2>/dev/null || true)"
-          },
+        ['target_arch in "ia32 x64" and OS!="win"', {
+          "variables": {"supports_avx2%": "<!(<!(echo ${CC_target:-${CC:-cc}}) -MM -E md5/md5-avx2.c -mavx2 2>/dev/null || true)"},
           "conditions": [
-            ['supports_omp_icc!=""', {
-              "cflags": ["-qopenmp"],
-              "cxxflags": ["-qopenmp"],
-              "ldflags": ["-qopenmp"],
+            ['supports_avx2!=""', {
+              "cflags": ["-mavx2"],
               "xcode_settings": {
-                "OTHER_CFLAGS": ["-qopenmp"],
-                "OTHER_CXXFLAGS": ["-qopenmp"],
-                "OTHER_LDFLAGS": ["-qopenmp"]
+                "OTHER_CFLAGS": ["-mavx2"]
               }
-            }],
-            ['supports_omp!="" and supports_omp_clang==""', {
-              "cflags": ["-fopenmp"],
-              "cxxflags": ["-fopenmp"],
-              "ldflags": ["-fopenmp"],
+            }]
+          ]
+        }],
+        ['target_arch in "ia32 x64" and OS=="win"', {
+          "msvs_settings": {"VCCLCompilerTool": {"EnableEnhancedInstructionSet": "3"}}
+        }]
+      ]
+    },
+    {
+      "target_name": "multi_md5_avx512",
+      "type": "static_library",
+      "sources": ["md5/md5-avx512.c"],
+      "cflags": ["-Wno-unused-function"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
+      "conditions": [
+        ['target_arch in "ia32 x64" and OS!="win"', {
+          "variables": {"supports_avx512%": "<!(<!(echo ${CC_target:-${CC:-cc}}) -MM -E md5/md5-avx512.c -mavx512vl 2>/dev/null || true)"},
+          "conditions": [
+            ['supports_avx512!=""', {
+              "cflags": ["-mavx512vl"],
               "xcode_settings": {
-                "OTHER_CFLAGS": ["-fopenmp"],
-                "OTHER_CXXFLAGS": ["-fopenmp"],
-                "OTHER_LDFLAGS": ["-fopenmp"]
+                "OTHER_CFLAGS": ["-mavx512vl"]
               }
-            }],
-            ['supports_omp_clang!=""', {
-              "cflags": ["-fopenmp=libomp"],
-              "cxxflags": ["-fopenmp=libomp"],
-              "ldflags": ["-fopenmp=libomp"],
+            }]
+          ]
+        }],
+        ['target_arch in "ia32 x64" and OS=="win"', {
+          "msvs_settings": {
+            "VCCLCompilerTool": {"AdditionalOptions": ["/arch:AVX512"], "EnableEnhancedInstructionSet": "0"}
+          }
+        }]
+      ]
+    },
+    {
+      "target_name": "multi_md5_neon",
+      "type": "static_library",
+      "sources": ["md5/md5-neon.c"],
+      "cflags": ["-Wno-unused-function"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
+      "conditions": [
+        ['OS!="win" and target_arch=="arm"', {
+          "cflags": ["-mfpu=neon"],
+          "xcode_settings": {
+            "OTHER_CFLAGS": ["-mfpu=neon"]
+          }
+        }],
+        ['OS!="win" and target_arch=="arm" and enable_native_tuning==0', {
+          "cflags": ["-march=armv7-a"],
+          "xcode_settings": {
+            "OTHER_CFLAGS": ["-march=armv7-a"]
+          }
+        }]
+      ]
+    },
+    {
+      "target_name": "crc32",
+      "type": "static_library",
+      "sources": ["crc/crc32.c"],
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "xcode_settings": {
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}}
+    },
+    {
+      "target_name": "crc32_clmul",
+      "type": "static_library",
+      "sources": ["crc/crc32-clmul.c"],
+      "cflags": ["-Wno-unused-function"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
+      "conditions": [
+        ['target_arch in "ia32 x64" and OS!="win"', {
+          "variables": {"supports_pclmul%": "<!(<!(echo ${CC_target:-${CC:-cc}}) -MM -E crc/crc32-clmul.c -mpclmul 2>/dev/null || true)"},
+          "conditions": [
+            ['supports_pclmul!=""', {
+              "cflags": ["-mpclmul"],
               "xcode_settings": {
-                "OTHER_CFLAGS": ["-fopenmp=libomp"],
-                "OTHER_CXXFLAGS": ["-fopenmp=libomp"],
-                "OTHER_LDFLAGS": ["-fopenmp=libomp"]
+                "OTHER_CFLAGS": ["-mpclmul"]
               }
             }]
           ]
@@ -85,16 +173,59 @@
       ]
     },
     {
-      "target_name": "multi_md5",
+      "target_name": "crc32_vclmul",
       "type": "static_library",
-      "sources": ["md5/md5.c", "md5/md5-simd.c"],
+      "sources": ["crc/crc32-vclmul.c"],
+      "cflags": ["-Wno-unused-function"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+      },
       "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
-      "cxxflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
+      "conditions": [
+        ['target_arch in "ia32 x64" and OS!="win"', {
+          "variables": {"supports_vpclmul%": "<!(<!(echo ${CC_target:-${CC:-cc}}) -MM -E crc/crc32-vclmul.c -mavx512f -mvpclmulqdq -mpclmul 2>/dev/null || true)"},
+          "conditions": [
+            ['supports_vpclmul!=""', {
+              "cflags": ["-mavx512f", "-mvpclmulqdq", "-mpclmul"],
+              "xcode_settings": {
+                "OTHER_CFLAGS": ["-mavx512f", "-mvpclmulqdq", "-mpclmul"]
+              }
+            }]
+          ]
+        }],
+        ['target_arch in "ia32 x64" and OS=="win"', {
+          "msvs_settings": {
+            "VCCLCompilerTool": {"AdditionalOptions": ["/arch:AVX512"], "EnableEnhancedInstructionSet": "0"}
+          }
+        }]
+      ]
+    },
+    {
+      "target_name": "crc32_arm",
+      "type": "static_library",
+      "sources": ["crc/crc32-arm.c"],
+      "cflags": ["-Wno-unused-function"],
       "xcode_settings": {
-        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
-        "OTHER_CXXFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
+        "OTHER_CFLAGS": ["-Wno-unused-function"],
+        "OTHER_CFLAGS!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"]
       },
-      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}}
+      "cflags!": ["-fno-omit-frame-pointer", "-fno-tree-vrp", "-fno-strict-aliasing"],
+      "msvs_settings": {"VCCLCompilerTool": {"BufferSecurityCheck": "false"}},
+      "conditions": [
+        ['target_arch in "arm arm64" and OS!="win"', {
+          "variables": {"supports_crc%": "<!(<!(echo ${CC_target:-${CC:-cc}}) -MM -E crc/crc32-arm.c -march=armv8-a+crc 2>/dev/null || true)"},
+          "conditions": [
+            ['supports_crc!=""', {
+              "cflags": ["-march=armv8-a+crc"],
+              "xcode_settings": {
+                "OTHER_CFLAGS": ["-march=armv8-a+crc"]
+              }
+            }]
+          ]
+        }]
+      ]
     },
     {
       "target_name": "gf16",
@@ -174,7 +305,8 @@
       "type": "static_library",
       "defines": ["NDEBUG"],
       "sources": [
-        "gf16/gf16_shuffle_avx.c"
+        "gf16/gf16_shuffle_avx.c",
+        "gf16/gf16_xor_avx.c"
       ],
       "cflags": ["-Wno-unused-function"],
       "xcode_settings": {
@@ -238,7 +370,8 @@
       "defines": ["NDEBUG"],
       "sources": [
         "gf16/gf16_xor_avx512.c",
-        "gf16/gf16_shuffle_avx512.c"
+        "gf16/gf16_shuffle_avx512.c",
+        "gf16/gf16_shuffle256_avx512.c"
       ],
       "cflags": ["-Wno-unused-function"],
       "xcode_settings": {
@@ -374,7 +507,8 @@
       "type": "static_library",
       "defines": ["NDEBUG"],
       "sources": [
-        "gf16/gf16_affine_avx512.c"
+        "gf16/gf16_affine_avx512.c",
+        "gf16/gf16_affine256_avx512.c"
       ],
       "cflags": ["-Wno-unused-function"],
       "xcode_settings": {
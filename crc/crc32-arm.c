@@ -0,0 +1,64 @@
+#include "crc32.h"
+#include "../gf16/platform.h"
+
+#ifdef __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#include <string.h>
+int crc32_available_arm = 1;
+
+static HEDLEY_ALWAYS_INLINE uint64_t crc32_load64(const uint8_t* src) {
+	uint64_t v;
+	memcpy(&v, src, 8);
+	return v;
+}
+
+static HEDLEY_ALWAYS_INLINE uint32_t crc32_update_arm(uint32_t state, const uint8_t* src, size_t len) {
+	while(len >= 8) {
+		state = __crc32d(state, crc32_load64(src));
+		src += 8;
+		len -= 8;
+	}
+	while(len--)
+		state = __crc32b(state, *src++);
+	return state;
+}
+
+uint32_t crc32_calc_arm(const void* data, size_t len, uint32_t crc) {
+	return ~crc32_update_arm(~crc, (const uint8_t*)data, len);
+}
+
+void crc32_multi_arm(uint32_t* crcs, const void* const* data, size_t len, unsigned num) {
+	/* the CRC instructions have a latency of a few cycles but can issue every cycle, so interleave four buffers to keep the unit busy */
+	unsigned i = 0;
+	for(; i+4 <= num; i+=4) {
+		const uint8_t* src0 = (const uint8_t*)data[i];
+		const uint8_t* src1 = (const uint8_t*)data[i+1];
+		const uint8_t* src2 = (const uint8_t*)data[i+2];
+		const uint8_t* src3 = (const uint8_t*)data[i+3];
+		uint32_t state0 = ~crcs[i], state1 = ~crcs[i+1], state2 = ~crcs[i+2], state3 = ~crcs[i+3];
+		size_t pos = 0;
+		for(; pos+8 <= len; pos+=8) {
+			state0 = __crc32d(state0, crc32_load64(src0 + pos));
+			state1 = __crc32d(state1, crc32_load64(src1 + pos));
+			state2 = __crc32d(state2, crc32_load64(src2 + pos));
+			state3 = __crc32d(state3, crc32_load64(src3 + pos));
+		}
+		crcs[i] = ~crc32_update_arm(state0, src0 + pos, len - pos);
+		crcs[i+1] = ~crc32_update_arm(state1, src1 + pos, len - pos);
+		crcs[i+2] = ~crc32_update_arm(state2, src2 + pos, len - pos);
+		crcs[i+3] = ~crc32_update_arm(state3, src3 + pos, len - pos);
+	}
+	for(; i<num; i++)
+		crcs[i] = crc32_calc_arm(data[i], len, crcs[i]);
+}
+#else
+int crc32_available_arm = 0;
+
+uint32_t crc32_calc_arm(const void* data, size_t len, uint32_t crc) {
+	(void)data; (void)len; (void)crc;
+	return 0;
+}
+void crc32_multi_arm(uint32_t* crcs, const void* const* data, size_t len, unsigned num) {
+	(void)crcs; (void)data; (void)len; (void)num;
+}
+#endif
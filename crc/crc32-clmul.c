@@ -0,0 +1,42 @@
+#include "crc32.h"
+#include "../gf16/platform.h"
+
+#ifdef __PCLMUL__
+#include "crc32-clmul.h"
+int crc32_available_clmul = 1;
+
+uint32_t crc32_calc_clmul(const void* data, size_t len, uint32_t crc) {
+	const char* src = (const char*)data;
+	__m128i x0, x1, x2, x3;
+	if(len < 64)
+		return crc32_calc_generic(data, len, crc);
+	
+	/* fold four blocks in parallel to hide the multiply latency */
+	x0 = _mm_xor_si128(_mm_loadu_si128((__m128i*)src), _mm_cvtsi32_si128(~crc));
+	x1 = _mm_loadu_si128((__m128i*)(src + 16));
+	x2 = _mm_loadu_si128((__m128i*)(src + 32));
+	x3 = _mm_loadu_si128((__m128i*)(src + 48));
+	src += 64;
+	len -= 64;
+	while(len >= 64) {
+		x0 = crc32_fold_clmul(x0, CRC32_K_512, _mm_loadu_si128((__m128i*)src));
+		x1 = crc32_fold_clmul(x1, CRC32_K_512, _mm_loadu_si128((__m128i*)(src + 16)));
+		x2 = crc32_fold_clmul(x2, CRC32_K_512, _mm_loadu_si128((__m128i*)(src + 32)));
+		x3 = crc32_fold_clmul(x3, CRC32_K_512, _mm_loadu_si128((__m128i*)(src + 48)));
+		src += 64;
+		len -= 64;
+	}
+	
+	x1 = crc32_fold_clmul(x0, CRC32_K_128, x1);
+	x2 = crc32_fold_clmul(x1, CRC32_K_128, x2);
+	x3 = crc32_fold_clmul(x2, CRC32_K_128, x3);
+	return crc32_finish_clmul(x3, src, len);
+}
+#else
+int crc32_available_clmul = 0;
+
+uint32_t crc32_calc_clmul(const void* data, size_t len, uint32_t crc) {
+	(void)data; (void)len; (void)crc;
+	return 0;
+}
+#endif
@@ -0,0 +1,27 @@
+#include <wmmintrin.h>
+
+/* folding constants for the bit-reflected polynomial; the low half holds x^(D+32) mod P and the high half x^(D-32) mod P, where D is the fold distance in bits */
+#define CRC32_K_128 _mm_set_epi32(0, 0xccaa009e, 1, 0x751997d0)
+#define CRC32_K_512 _mm_set_epi32(1, 0xc6e41596, 1, 0x54442bd4)
+
+static HEDLEY_ALWAYS_INLINE __m128i crc32_fold_clmul(__m128i x, __m128i k, __m128i data) {
+	return _mm_xor_si128(
+		_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)),
+		data
+	);
+}
+
+/* folds any remaining 16 byte blocks into x, then reduces it and processes the tail, returning the final CRC */
+static HEDLEY_ALWAYS_INLINE uint32_t crc32_finish_clmul(__m128i x, const char* src, size_t len) {
+	uint8_t tmp[16];
+	uint32_t state;
+	while(len >= 16) {
+		x = crc32_fold_clmul(x, CRC32_K_128, _mm_loadu_si128((__m128i*)src));
+		src += 16;
+		len -= 16;
+	}
+	/* x is congruent to the data consumed so far, so its CRC (from a zero state) is the state for the whole prefix */
+	_mm_storeu_si128((__m128i*)tmp, x);
+	state = crc32_update_generic(0, tmp, 16);
+	return ~crc32_update_generic(state, src, len);
+}
@@ -0,0 +1,65 @@
+#include "crc32.h"
+#include "../gf16/platform.h"
+
+#if defined(__AVX512F__) && defined(__VPCLMULQDQ__)
+#include "crc32-clmul.h"
+int crc32_available_vclmul = 1;
+
+#define CRC32_K_2048 _mm512_broadcast_i32x4(_mm_set_epi32(1, 0x322d1430, 1, 0x1542778a))
+
+static HEDLEY_ALWAYS_INLINE __m512i crc32_fold_vclmul(__m512i x, __m512i k, __m512i data) {
+	return _mm512_ternarylogic_epi32(
+		_mm512_clmulepi64_epi128(x, k, 0x00),
+		_mm512_clmulepi64_epi128(x, k, 0x11),
+		data,
+		0x96
+	);
+}
+
+uint32_t crc32_calc_vclmul(const void* data, size_t len, uint32_t crc) {
+	const char* src = (const char*)data;
+	__m512i z0, z1, z2, z3, k;
+	__m128i x;
+	if(len < 256)
+		return crc32_calc_clmul(data, len, crc);
+	
+	z0 = _mm512_xor_si512(_mm512_loadu_si512(src), _mm512_castsi128_si512(_mm_cvtsi32_si128(~crc)));
+	z1 = _mm512_loadu_si512(src + 64);
+	z2 = _mm512_loadu_si512(src + 128);
+	z3 = _mm512_loadu_si512(src + 192);
+	src += 256;
+	len -= 256;
+	k = CRC32_K_2048;
+	while(len >= 256) {
+		z0 = crc32_fold_vclmul(z0, k, _mm512_loadu_si512(src));
+		z1 = crc32_fold_vclmul(z1, k, _mm512_loadu_si512(src + 64));
+		z2 = crc32_fold_vclmul(z2, k, _mm512_loadu_si512(src + 128));
+		z3 = crc32_fold_vclmul(z3, k, _mm512_loadu_si512(src + 192));
+		src += 256;
+		len -= 256;
+	}
+	
+	k = _mm512_broadcast_i32x4(CRC32_K_512);
+	z1 = crc32_fold_vclmul(z0, k, z1);
+	z2 = crc32_fold_vclmul(z1, k, z2);
+	z3 = crc32_fold_vclmul(z2, k, z3);
+	while(len >= 64) {
+		z3 = crc32_fold_vclmul(z3, k, _mm512_loadu_si512(src));
+		src += 64;
+		len -= 64;
+	}
+	
+	/* reduce the four lanes to one */
+	x = crc32_fold_clmul(_mm512_castsi512_si128(z3), CRC32_K_128, _mm512_extracti32x4_epi32(z3, 1));
+	x = crc32_fold_clmul(x, CRC32_K_128, _mm512_extracti32x4_epi32(z3, 2));
+	x = crc32_fold_clmul(x, CRC32_K_128, _mm512_extracti32x4_epi32(z3, 3));
+	return crc32_finish_clmul(x, src, len);
+}
+#else
+int crc32_available_vclmul = 0;
+
+uint32_t crc32_calc_vclmul(const void* data, size_t len, uint32_t crc) {
+	(void)data; (void)len; (void)crc;
+	return 0;
+}
+#endif
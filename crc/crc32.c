@@ -0,0 +1,163 @@
+#include "crc32.h"
+#include "../gf16/platform.h"
+
+#ifdef PLATFORM_X86
+# ifdef _MSC_VER
+#  include <intrin.h>
+#  define _cpuid __cpuid
+#  define _cpuidX __cpuidex
+#  if _MSC_VER >= 1600
+#   include <immintrin.h>
+#   define _GET_XCR() _xgetbv(_XCR_XFEATURE_ENABLED_MASK)
+#  endif
+# else
+#  include <cpuid.h>
+#  define _cpuid(ar, eax) __cpuid(eax, ar[0], ar[1], ar[2], ar[3])
+#  define _cpuidX(ar, eax, ecx) __cpuid_count(eax, ecx, ar[0], ar[1], ar[2], ar[3])
+static inline int _GET_XCR() {
+	int xcr0;
+	__asm__ __volatile__("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
+	return xcr0;
+}
+# endif
+#endif
+#ifdef PLATFORM_ARM
+# ifdef __ANDROID__
+#  include <cpu-features.h>
+# elif defined(__linux__)
+#  include <sys/auxv.h>
+#  include <asm/hwcap.h>
+# endif
+#endif
+
+#define CRC32_POLY 0xedb88320
+
+/* slice-by-4 lookup tables, filled by crc32_init */
+static uint32_t crc32_table[4][256];
+/* x^(2^n) mod P, used for zero extension */
+static uint32_t crc32_x2n[32];
+
+uint32_t crc32_update_generic(uint32_t state, const void* data, size_t len) {
+	const uint8_t* src = (const uint8_t*)data;
+	while(len >= 4) {
+		state ^= src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+		state = crc32_table[3][state & 0xff] ^ crc32_table[2][(state >> 8) & 0xff]
+		      ^ crc32_table[1][(state >> 16) & 0xff] ^ crc32_table[0][state >> 24];
+		src += 4;
+		len -= 4;
+	}
+	while(len--)
+		state = (state >> 8) ^ crc32_table[0][(state ^ *src++) & 0xff];
+	return state;
+}
+
+uint32_t crc32_calc_generic(const void* data, size_t len, uint32_t crc) {
+	return ~crc32_update_generic(~crc, data, len);
+}
+
+/* processes each buffer in turn, with whatever single buffer implementation is selected */
+void crc32_multi_generic(uint32_t* crcs, const void* const* data, size_t len, unsigned num) {
+	unsigned i;
+	for(i=0; i<num; i++)
+		crcs[i] = crc32_calc(data[i], len, crcs[i]);
+}
+
+crc32_calc_fn crc32_calc = &crc32_calc_generic;
+crc32_multi_fn crc32_multi = &crc32_multi_generic;
+
+
+/* multiply two polynomials modulo P, both in bit-reflected form */
+static uint32_t crc32_multmodp(uint32_t a, uint32_t b) {
+	uint32_t m = (uint32_t)1 << 31;
+	uint32_t p = 0;
+	while(1) {
+		if(a & m) {
+			p ^= b;
+			if((a & (m - 1)) == 0)
+				break;
+		}
+		m >>= 1;
+		b = b & 1 ? (b >> 1) ^ CRC32_POLY : b >> 1;
+	}
+	return p;
+}
+
+uint32_t crc32_zeroes(uint32_t crc, uint64_t len) {
+	/* appending zeroes multiplies the CRC state by x^(8*len); build that from the x^(2^n) powers, starting at n=3 to account for the factor of 8 */
+	uint32_t xpow = (uint32_t)1 << 31; /* x^0 */
+	unsigned n = 3;
+	if(len == 0)
+		return crc;
+	while(len) {
+		if(len & 1)
+			xpow = crc32_multmodp(crc32_x2n[n & 31], xpow);
+		len >>= 1;
+		n++;
+	}
+	return ~crc32_multmodp(xpow, ~crc);
+}
+
+
+void crc32_init(void) {
+	uint32_t i, j, p;
+	for(i=0; i<256; i++) {
+		uint32_t v = i;
+		for(j=0; j<8; j++)
+			v = v & 1 ? (v >> 1) ^ CRC32_POLY : v >> 1;
+		crc32_table[0][i] = v;
+	}
+	for(i=0; i<256; i++)
+		for(j=1; j<4; j++)
+			crc32_table[j][i] = (crc32_table[j-1][i] >> 8) ^ crc32_table[0][crc32_table[j-1][i] & 0xff];
+	
+	p = (uint32_t)1 << 30; /* x^1 */
+	crc32_x2n[0] = p;
+	for(i=1; i<32; i++)
+		crc32_x2n[i] = p = crc32_multmodp(p, p);
+	
+#ifdef PLATFORM_X86
+	int hasClMul = 0, hasVClMul = 0;
+	int cpuInfo[4];
+	_cpuid(cpuInfo, 1);
+	hasClMul = (cpuInfo[2] & 0x2) == 0x2;
+# if !defined(_MSC_VER) || _MSC_VER >= 1600
+	int cpuInfoX[4];
+	_cpuidX(cpuInfoX, 7, 0);
+	if(cpuInfo[2] & 0x8000000) { /* has OSXSAVE */
+		int xcr = _GET_XCR() & 0xff;
+		if((xcr & 0xE6) == 0xE6) /* AVX512 state enabled */
+			hasVClMul = hasClMul
+				&& (cpuInfoX[1] & 0x10000) == 0x10000 /* AVX512F */
+				&& (cpuInfoX[2] & 0x400) == 0x400; /* VPCLMULQDQ */
+	}
+# endif
+	
+	if(crc32_available_vclmul && hasVClMul)
+		crc32_calc = &crc32_calc_vclmul;
+	else if(crc32_available_clmul && hasClMul)
+		crc32_calc = &crc32_calc_clmul;
+#endif
+#ifdef PLATFORM_ARM
+	int hasCRC = 0;
+# if defined(AT_HWCAP)
+#  ifdef __aarch64__
+	hasCRC = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#  elif defined(AT_HWCAP2) && defined(HWCAP2_CRC32)
+	hasCRC = (getauxval(AT_HWCAP2) & HWCAP2_CRC32) != 0;
+#  endif
+# elif defined(ANDROID_CPU_FAMILY_ARM)
+#  ifdef __aarch64__
+	hasCRC = (android_getCpuFeatures() & ANDROID_CPU_ARM64_FEATURE_CRC32) != 0;
+#  else
+	hasCRC = (android_getCpuFeatures() & ANDROID_CPU_ARM_FEATURE_CRC32) != 0;
+#  endif
+# elif defined(__aarch64__) && defined(__APPLE__)
+	hasCRC = 1;
+# endif
+	
+	if(crc32_available_arm && hasCRC) {
+		crc32_calc = &crc32_calc_arm;
+		crc32_multi = &crc32_multi_arm;
+	}
+#endif
+}
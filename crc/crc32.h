@@ -0,0 +1,27 @@
+#include "../src/stdint.h"
+#include <stdlib.h>
+
+/* CRC32 (as used by PAR2/zlib); crc is the value from a previous call, or 0 to start */
+typedef uint32_t(*crc32_calc_fn)(const void* data, size_t len, uint32_t crc);
+extern crc32_calc_fn crc32_calc;
+/* computes the CRC of `num` buffers, each of length `len`, updating crcs[] */
+typedef void(*crc32_multi_fn)(uint32_t* crcs, const void* const* data, size_t len, unsigned num);
+extern crc32_multi_fn crc32_multi;
+
+/* extends crc as if `len` zero bytes were appended */
+uint32_t crc32_zeroes(uint32_t crc, uint64_t len);
+/* selects the fastest implementation available on the CPU */
+void crc32_init(void);
+
+/* table based implementation, operating on the raw (un-inverted) CRC state */
+uint32_t crc32_update_generic(uint32_t state, const void* data, size_t len);
+uint32_t crc32_calc_generic(const void* data, size_t len, uint32_t crc);
+void crc32_multi_generic(uint32_t* crcs, const void* const* data, size_t len, unsigned num);
+
+extern int crc32_available_clmul;
+extern int crc32_available_vclmul;
+extern int crc32_available_arm;
+uint32_t crc32_calc_clmul(const void* data, size_t len, uint32_t crc);
+uint32_t crc32_calc_vclmul(const void* data, size_t len, uint32_t crc);
+uint32_t crc32_calc_arm(const void* data, size_t len, uint32_t crc);
+void crc32_multi_arm(uint32_t* crcs, const void* const* data, size_t len, unsigned num);
@@ -0,0 +1,58 @@
+#ifdef _AVAILABLE
+# include "gf16_muladd_multi.h"
+
+// XOR of multiple regions, with the same interface as the multiply-add kernels (coefficients are ignored), so that the multi-region framework can drive it
+// sources are read in blocks of blockWords vectors, which must match the block size the method packs inputs with
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_add_x)(uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len, const unsigned blockWords) {
+	GF16_MULADD_MULTI_SRC_UNUSED(13);
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(_mword)*blockWords) {
+		for(unsigned word = 0; word < blockWords; word++) {
+			intptr_t srcPtr = ptr*srcScale + word*sizeof(_mword);
+			_mword* dstWord = (_mword*)(_dst + ptr) + word;
+			#define _LD(n) _MMI(load)((_mword*)(_src##n + srcPtr))
+			_mword result = doStore ? _LD(1) : _MMI(xor)(_MMI(load)(dstWord), _LD(1));
+#if MWORD_SIZE == 64 || defined(_AVAILABLE_AVX512VL)
+			// fold in two sources per instruction
+			#define _ADD_PAIR(a, b) \
+				if(srcCount >= b) result = _MM(ternarylogic_epi32)(result, _LD(a), _LD(b), 0x96); \
+				else if(srcCount >= a) result = _MMI(xor)(result, _LD(a))
+			_ADD_PAIR(2, 3);
+			_ADD_PAIR(4, 5);
+			_ADD_PAIR(6, 7);
+			_ADD_PAIR(8, 9);
+			_ADD_PAIR(10, 11);
+			_ADD_PAIR(12, 13);
+			#undef _ADD_PAIR
+#else
+			#define _ADD_SRC(n) if(srcCount >= n) result = _MMI(xor)(result, _LD(n))
+			_ADD_SRC(2);
+			_ADD_SRC(3);
+			_ADD_SRC(4);
+			_ADD_SRC(5);
+			_ADD_SRC(6);
+			_ADD_SRC(7);
+			_ADD_SRC(8);
+			_ADD_SRC(9);
+			_ADD_SRC(10);
+			_ADD_SRC(11);
+			_ADD_SRC(12);
+			_ADD_SRC(13);
+			#undef _ADD_SRC
+#endif
+			#undef _LD
+			_MMI(store)(dstWord, result);
+		}
+	}
+}
+
+// kernels for methods packing inputs in blocks of one or two vectors
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_add_x_block1)(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf) {
+	UNUSED(scratch); UNUSED(coefficients); UNUSED(doPrefetch); UNUSED(_pf);
+	_FN(gf16_add_x)(_dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, 1);
+}
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_add_x_block2)(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf) {
+	UNUSED(scratch); UNUSED(coefficients); UNUSED(doPrefetch); UNUSED(_pf);
+	_FN(gf16_add_x)(_dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, 2);
+}
+#endif
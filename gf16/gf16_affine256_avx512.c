@@ -0,0 +1,463 @@
+
+#include "gf16_global.h"
+#include "platform.h"
+
+// 256-bit variant of affine-avx512, using the same data layout as affine-avx2; AVX512VL's 32 registers allow twice the number of regions to be processed at once
+#define MWORD_SIZE 32
+#define _mword __m256i
+#define _MM(f) _mm256_ ## f
+#define _MMI(f) _mm256_ ## f ## _si256
+#define _FN(f) f ## _256_avx512
+#define _MM_END _mm256_zeroupper();
+
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+int gf16_affine_available_256_avx512 = 1;
+# define _AVAILABLE 1
+# define _AVAILABLE_AVX512VL 1
+# include "gf16_shuffle_x86_prepare.h"
+# include "gf16_checksum_x86.h"
+# include "gf16_add_x86.h"
+#else
+int gf16_affine_available_256_avx512 = 0;
+#endif
+
+#ifdef _AVAILABLE
+# undef _AVAILABLE
+#endif
+#ifdef _AVAILABLE_AVX512VL
+# undef _AVAILABLE_AVX512VL
+#endif
+#undef _MM_END
+#undef _FN
+#undef _MMI
+#undef _MM
+#undef _mword
+#undef MWORD_SIZE
+
+void gf16_affine_prepare_packed_256_avx512(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m256i)*2, &gf16_shuffle_prepare_block_256_avx512, &gf16_shuffle_prepare_blocku_256_avx512, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		1
+#endif
+	, NULL, NULL, NULL, NULL, NULL);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+void gf16_affine_prepare_packed_cksum_256_avx512(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	__m256i checksum = _mm256_setzero_si256();
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m256i)*2, &gf16_shuffle_prepare_block_256_avx512, &gf16_shuffle_prepare_blocku_256_avx512, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		1
+#endif
+	, &checksum, &gf16_checksum_block_256_avx512, &gf16_checksum_blocku_256_avx512, &gf16_checksum_zeroes_256_avx512, &gf16_checksum_prepare_256_avx512);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine_load_matrix(const void *HEDLEY_RESTRICT scratch, uint16_t coefficient) {
+	__m256i depmask = _mm256_xor_si256(
+		_mm256_load_si256((__m256i*)scratch + (coefficient & 0xf)*4),
+		_mm256_load_si256((__m256i*)((char*)scratch + ((coefficient << 3) & 0x780)) + 1)
+	);
+	depmask = _mm256_ternarylogic_epi32(
+		depmask,
+		_mm256_load_si256((__m256i*)((char*)scratch + ((coefficient >> 1) & 0x780)) + 2),
+		_mm256_load_si256((__m256i*)((char*)scratch + ((coefficient >> 5) & 0x780)) + 3),
+		0x96
+	);
+	return depmask;
+}
+// as above, but if expanded is set, coefficients points to matrices previously generated by gf16_affine_expand_256_avx512, instead of regular coefficients
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine_load_matrix_x(const int expanded, const void *HEDLEY_RESTRICT scratch, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned idx) {
+	if(expanded)
+		return _mm256_load_si256((const __m256i*)coefficients + idx);
+	return gf16_affine_load_matrix(scratch, coefficients[idx]);
+}
+#endif
+
+void gf16_affine_mul_256_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	__m256i depmask = gf16_affine_load_matrix(scratch, coefficient);
+
+	__m256i mat_ll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
+	__m256i mat_hh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
+	__m256i mat_lh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3));
+	__m256i mat_hl = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(2,2,2,2));
+
+	uint8_t* _src = (uint8_t*)src + len;
+	uint8_t* _dst = (uint8_t*)dst + len;
+
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)*2) {
+		__m256i ta = _mm256_load_si256((__m256i*)(_src + ptr));
+		__m256i tb = _mm256_load_si256((__m256i*)(_src + ptr) + 1);
+
+		__m256i tpl = _mm256_xor_si256(
+			_mm256_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+			_mm256_gf2p8affine_epi64_epi8(tb, mat_ll, 0)
+		);
+		__m256i tph = _mm256_xor_si256(
+			_mm256_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+			_mm256_gf2p8affine_epi64_epi8(tb, mat_hl, 0)
+		);
+
+		_mm256_store_si256 ((__m256i*)(_dst + ptr), tph);
+		_mm256_store_si256 ((__m256i*)(_dst + ptr) + 1, tpl);
+	}
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_round(const __m256i* src, __m256i* tpl, __m256i* tph, __m256i mat_ll, __m256i mat_hl, __m256i mat_lh, __m256i mat_hh) {
+	__m256i ta = _mm256_load_si256(src);
+	__m256i tb = _mm256_load_si256(src + 1);
+
+	*tpl = _mm256_ternarylogic_epi32(
+		_mm256_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+		_mm256_gf2p8affine_epi64_epi8(tb, mat_ll, 0),
+		*tpl,
+		0x96
+	);
+	*tph = _mm256_ternarylogic_epi32(
+		_mm256_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+		_mm256_gf2p8affine_epi64_epi8(tb, mat_hl, 0),
+		*tph,
+		0x96
+	);
+}
+#include "gf16_muladd_multi.h"
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_common_256_avx512(
+	const int expanded, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	GF16_MULADD_MULTI_SRC_UNUSED(6);
+
+	__m256i mat_All, mat_Alh, mat_Ahl, mat_Ahh;
+	__m256i mat_Bll, mat_Blh, mat_Bhl, mat_Bhh;
+	__m256i mat_Cll, mat_Clh, mat_Chl, mat_Chh;
+	__m256i mat_Dll, mat_Dlh, mat_Dhl, mat_Dhh;
+	__m256i mat_Ell, mat_Elh, mat_Ehl, mat_Ehh;
+	__m256i mat_Fll, mat_Flh, mat_Fhl, mat_Fhh;
+
+	__m256i depmask;
+	#define LOAD_MAT(dstVec, idx) \
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, idx); \
+		dstVec##ll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask)); \
+		dstVec##hh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1)); \
+		dstVec##lh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3)); \
+		dstVec##hl = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(2,2,2,2))
+	LOAD_MAT(mat_A, 0);
+	if(srcCount >= 2) { LOAD_MAT(mat_B, 1); }
+	if(srcCount >= 3) { LOAD_MAT(mat_C, 2); }
+	if(srcCount >= 4) { LOAD_MAT(mat_D, 3); }
+	if(srcCount >= 5) { LOAD_MAT(mat_E, 4); }
+	if(srcCount >= 6) { LOAD_MAT(mat_F, 5); }
+	#undef LOAD_MAT
+
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)*2) {
+		__m256i tph = doStore ? _mm256_setzero_si256() : _mm256_load_si256((__m256i*)(_dst + ptr));
+		__m256i tpl = doStore ? _mm256_setzero_si256() : _mm256_load_si256((__m256i*)(_dst + ptr) + 1);
+		gf16_affine_muladd_round((__m256i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
+		if(srcCount >= 2)
+			gf16_affine_muladd_round((__m256i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
+		if(srcCount >= 3)
+			gf16_affine_muladd_round((__m256i*)(_src3 + ptr*srcScale), &tpl, &tph, mat_Cll, mat_Chl, mat_Clh, mat_Chh);
+		if(srcCount >= 4)
+			gf16_affine_muladd_round((__m256i*)(_src4 + ptr*srcScale), &tpl, &tph, mat_Dll, mat_Dhl, mat_Dlh, mat_Dhh);
+		if(srcCount >= 5)
+			gf16_affine_muladd_round((__m256i*)(_src5 + ptr*srcScale), &tpl, &tph, mat_Ell, mat_Ehl, mat_Elh, mat_Ehh);
+		if(srcCount >= 6)
+			gf16_affine_muladd_round((__m256i*)(_src6 + ptr*srcScale), &tpl, &tph, mat_Fll, mat_Fhl, mat_Flh, mat_Fhh);
+		_mm256_store_si256((__m256i*)(_dst + ptr), tph);
+		_mm256_store_si256((__m256i*)(_dst + ptr)+1, tpl);
+
+		if(doPrefetch == 1)
+			_mm_prefetch(_pf+ptr, MM_HINT_WT1);
+		if(doPrefetch == 2)
+			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
+	}
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_256_avx512(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_256_avx512(0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_xexp_256_avx512(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_256_avx512(1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+#endif /*defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)*/
+
+
+void gf16_affine_muladd_256_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_muladd_single(scratch, &gf16_affine_muladd_x_256_avx512, dst, src, len, coefficient);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void gf16_affine_muladd_prefetch_256_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch, const void *HEDLEY_RESTRICT prefetch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_muladd_prefetch_single(scratch, &gf16_affine_muladd_x_256_avx512, dst, src, len, coefficient, prefetch);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient); UNUSED(prefetch);
+#endif
+}
+
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+// same as the AVX2 version; the running product never leaves registers
+static HEDLEY_ALWAYS_INLINE void gf16_affine_pow_x_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, const int doAdd) {
+	__m256i depmask = gf16_affine_load_matrix(scratch, coefficient);
+
+	__m256i mat_ll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
+	__m256i mat_hh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
+	__m256i mat_lh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3));
+	__m256i mat_hl = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(2,2,2,2));
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)*2) {
+		__m256i ta = _mm256_load_si256((__m256i*)(_src + ptr));
+		__m256i tb = _mm256_load_si256((__m256i*)(_src + ptr) + 1);
+		for(unsigned output = 0; output < outputs; output++) {
+			__m256i tpl = _mm256_xor_si256(
+				_mm256_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+				_mm256_gf2p8affine_epi64_epi8(tb, mat_ll, 0)
+			);
+			ta = _mm256_xor_si256(
+				_mm256_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+				_mm256_gf2p8affine_epi64_epi8(tb, mat_hl, 0)
+			);
+			tb = tpl;
+			
+			__m256i* _dst = (__m256i*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_mm256_store_si256(_dst, _mm256_xor_si256(ta, _mm256_load_si256(_dst)));
+				_mm256_store_si256(_dst + 1, _mm256_xor_si256(tb, _mm256_load_si256(_dst + 1)));
+			} else {
+				_mm256_store_si256(_dst, ta);
+				_mm256_store_si256(_dst + 1, tb);
+			}
+		}
+	}
+}
+#endif
+
+void gf16_affine_pow_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_affine_pow_x_256_avx512(scratch, outputs, offset, dst, src, len, coefficient, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void gf16_affine_pow_add_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_affine_pow_x_256_avx512(scratch, outputs, offset, dst, src, len, coefficient, 1);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+unsigned gf16_affine_muladd_multi_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, offset, dst, src, len, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_mul_multi_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, offset, dst, src, len, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_muladd_multi_packed_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_mul_multi_packed_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_add_256_avx512(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_muladd_single(NULL, &gf16_add_x_block2_256_avx512, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine_add_multi_256_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block2_256_avx512, 6, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_store_256_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block2_256_avx512, 6, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_256_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block2_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_store_256_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block2_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+void gf16_affine_muladd_multi_packpf_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, coefficients, 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_mul_multi_packpf_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &gf16_affine_muladd_x_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, coefficients, 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_muladd_multi_packpf_exp_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_mul_multi_packpf_exp_256_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_256_avx512, 6, regions, dst, src, len, sizeof(__m256i)*2, expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# include "gf16_bitdep_init_avx2.h"
+#endif
+void* gf16_affine_init_256_avx512(int polynomial) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	__m256i* ret;
+	ALIGN_ALLOC(ret, sizeof(__m256i)*16*4, 32);
+	gf16_bitdep_init256(ret, polynomial, 1);
+	return ret;
+#else
+	UNUSED(polynomial);
+	return NULL;
+#endif
+}
+
+// computes the matrix for each coefficient, for use with the *_packpf_exp functions; each matrix takes 32 bytes, and dst must be 32-byte aligned
+void gf16_affine_expand_256_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	for(unsigned i=0; i<count; i++)
+		_mm256_store_si256((__m256i*)dst + i, gf16_affine_load_matrix(scratch, coefficients[i]));
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(coefficients); UNUSED(count);
+#endif
+}
@@ -19,6 +19,7 @@ int gf16_affine_available_avx2 = 0;
 #endif
 
 #include "gf16_affine2x_x86.h"
+#include "gf16_add_x86.h"
 #ifdef _AVAILABLE
 # undef _AVAILABLE
 #endif
@@ -72,6 +73,12 @@ static HEDLEY_ALWAYS_INLINE __m256i gf16_affine_load_matrix(const void *HEDLEY_R
 	depmask = _mm256_xor_si256(depmask, _mm256_load_si256((__m256i*)((char*)scratch + ((coefficient >> 5) & 0x780)) + 3));
 	return depmask;
 }
+// as above, but if expanded is set, coefficients points to matrices previously generated by gf16_affine_expand_avx2, instead of regular coefficients
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine_load_matrix_x(const int expanded, const void *HEDLEY_RESTRICT scratch, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned idx) {
+	if(expanded)
+		return _mm256_load_si256((const __m256i*)coefficients + idx);
+	return gf16_affine_load_matrix(scratch, coefficients[idx]);
+}
 #endif
 
 void gf16_affine_mul_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -120,14 +127,14 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_round(const __m256i* src, __
 	*tph = _mm256_xor_si256(*tph, _mm256_gf2p8affine_epi64_epi8(tb, mat_hl, 0));
 }
 #include "gf16_muladd_multi.h"
-static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
-	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_common_avx2(
+	const int expanded, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST, size_t len,
 	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
 	GF16_MULADD_MULTI_SRC_UNUSED(3);
-	__m256i depmask = gf16_affine_load_matrix(scratch, coefficients[0]);
+	__m256i depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 0);
 	
 	__m256i mat_All = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
 	__m256i mat_Ahh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
@@ -136,7 +143,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
 	
 	__m256i mat_Bll, mat_Bhh, mat_Bhl, mat_Blh;
 	if(srcCount >= 2) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[1]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 1);
 		mat_Bll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
 		mat_Bhh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
 		mat_Blh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3));
@@ -145,7 +152,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
 	
 	__m256i mat_Cll, mat_Chh, mat_Chl, mat_Clh;
 	if(srcCount > 2) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[2]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 2);
 		mat_Cll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
 		mat_Chh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
 		mat_Clh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3));
@@ -153,8 +160,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
 	}
 	
 	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)*2) {
-		__m256i tph = _mm256_load_si256((__m256i*)(_dst + ptr));
-		__m256i tpl = _mm256_load_si256((__m256i*)(_dst + ptr) + 1);
+		__m256i tph = doStore ? _mm256_setzero_si256() : _mm256_load_si256((__m256i*)(_dst + ptr));
+		__m256i tpl = doStore ? _mm256_setzero_si256() : _mm256_load_si256((__m256i*)(_dst + ptr) + 1);
 		gf16_affine_muladd_round((__m256i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 		if(srcCount > 1)
 			gf16_affine_muladd_round((__m256i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -169,6 +176,22 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
 			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_avx2(0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_xexp_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_avx2(1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__AVX2__)*/
 
 
@@ -192,6 +215,66 @@ void gf16_affine_muladd_prefetch_avx2(const void *HEDLEY_RESTRICT scratch, void
 #endif
 }
 
+#if defined(__GFNI__) && defined(__AVX2__)
+// computes successive powers of the coefficient times src, keeping the running product in registers
+static HEDLEY_ALWAYS_INLINE void gf16_affine_pow_x_avx2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, const int doAdd) {
+	__m256i depmask = gf16_affine_load_matrix(scratch, coefficient);
+	
+	__m256i mat_ll = _mm256_broadcastq_epi64(_mm256_castsi256_si128(depmask));
+	__m256i mat_hh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(1,1,1,1));
+	__m256i mat_lh = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(3,3,3,3));
+	__m256i mat_hl = _mm256_permute4x64_epi64(depmask, _MM_SHUFFLE(2,2,2,2));
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)*2) {
+		__m256i ta = _mm256_load_si256((__m256i*)(_src + ptr));
+		__m256i tb = _mm256_load_si256((__m256i*)(_src + ptr) + 1);
+		for(unsigned output = 0; output < outputs; output++) {
+			__m256i tpl = _mm256_xor_si256(
+				_mm256_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+				_mm256_gf2p8affine_epi64_epi8(tb, mat_ll, 0)
+			);
+			ta = _mm256_xor_si256(
+				_mm256_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+				_mm256_gf2p8affine_epi64_epi8(tb, mat_hl, 0)
+			);
+			tb = tpl;
+			
+			__m256i* _dst = (__m256i*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_mm256_store_si256(_dst, _mm256_xor_si256(ta, _mm256_load_si256(_dst)));
+				_mm256_store_si256(_dst + 1, _mm256_xor_si256(tb, _mm256_load_si256(_dst + 1)));
+			} else {
+				_mm256_store_si256(_dst, ta);
+				_mm256_store_si256(_dst + 1, tb);
+			}
+		}
+	}
+}
+#endif
+
+void gf16_affine_pow_avx2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_affine_pow_x_avx2(scratch, outputs, offset, dst, src, len, coefficient, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void gf16_affine_pow_add_avx2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_affine_pow_x_avx2(scratch, outputs, offset, dst, src, len, coefficient, 1);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
@@ -204,6 +287,18 @@ unsigned gf16_affine_muladd_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsi
 #endif
 }
 
+unsigned gf16_affine_mul_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine_muladd_x_avx2, 3, regions, offset, dst, src, len, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
@@ -216,6 +311,71 @@ unsigned gf16_affine_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scratc
 #endif
 }
 
+unsigned gf16_affine_mul_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine_muladd_x_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_add_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_muladd_single(NULL, &gf16_add_x_block2_avx2, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine_add_multi_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block2_avx2, 3, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_store_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block2_avx2, 3, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block2_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_store_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block2_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
@@ -226,6 +386,36 @@ void gf16_affine_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, u
 #endif
 }
 
+void gf16_affine_mul_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &gf16_affine_muladd_x_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, coefficients, 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_muladd_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_mul_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_avx2, 3, regions, dst, src, len, sizeof(__m256i)*2, expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
 
 #if defined(__GFNI__) && defined(__AVX2__)
 # include "gf16_bitdep_init_avx2.h"
@@ -242,12 +432,38 @@ void* gf16_affine_init_avx2(int polynomial) {
 #endif
 }
 
+// computes the matrix for each coefficient, for use with the *_packpf_exp functions; each matrix takes 32 bytes, and dst must be 32-byte aligned
+void gf16_affine_expand_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	for(unsigned i=0; i<count; i++)
+		_mm256_store_si256((__m256i*)dst + i, gf16_affine_load_matrix(scratch, coefficients[i]));
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(coefficients); UNUSED(count);
+#endif
+}
+
 
 
 #if defined(__GFNI__) && defined(__AVX2__)
-static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx2(
-	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+// for the natural byte order variant, split bytes into the 2x layout when loading, and join them back before writing out
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine2x_load_src_avx2(const int nt, const uint8_t* src) {
+	__m256i data = _mm256_load_si256((__m256i*)src);
+	if(nt) data = _mm256_shuffle_epi8(data, _mm256_set_epi32(
+		0x0f0d0b09, 0x07050301, 0x0e0c0a08, 0x06040200,
+		0x0f0d0b09, 0x07050301, 0x0e0c0a08, 0x06040200
+	));
+	return data;
+}
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine2x_join_avx2(__m256i data) {
+	return _mm256_shuffle_epi8(data, _mm256_set_epi32(
+		0x0f070e06, 0x0d050c04, 0x0b030a02, 0x09010800,
+		0x0f070e06, 0x0d050c04, 0x0b030a02, 0x09010800
+	));
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_common_avx2(
+	const int expanded, const int nt, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST,
 	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
@@ -260,31 +476,31 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx2(
 	__m256i matNormE, matSwapE;
 	__m256i matNormF, matSwapF;
 	
-	__m256i depmask = gf16_affine_load_matrix(scratch, coefficients[0]);
+	__m256i depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 0);
 	matNormA = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 	matSwapA = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	if(srcCount >= 2) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[1]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 1);
 		matNormB = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 		matSwapB = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	}
 	if(srcCount >= 3) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[2]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 2);
 		matNormC = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 		matSwapC = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	}
 	if(srcCount >= 4) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[3]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 3);
 		matNormD = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 		matSwapD = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	}
 	if(srcCount >= 5) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[4]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 4);
 		matNormE = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 		matSwapE = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	}
 	if(srcCount >= 6) {
-		depmask = gf16_affine_load_matrix(scratch, coefficients[5]);
+		depmask = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 5);
 		matNormF = _mm256_inserti128_si256(depmask, _mm256_castsi256_si128(depmask), 1);
 		matSwapF = _mm256_permute2x128_si256(depmask, depmask, 0x11);
 	}
@@ -297,39 +513,41 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx2(
 		if(doPrefetch == 2)
 			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
 		if(ptr & (sizeof(__m256i)*2-1)) { // align to a cacheline boundary
-			__m256i data = _mm256_load_si256((__m256i*)(_src1 + ptr*srcScale));
+			__m256i data = gf16_affine2x_load_src_avx2(nt, _src1 + ptr*srcScale);
 			__m256i result1 = _mm256_gf2p8affine_epi64_epi8(data, matNormA, 0);
 			__m256i result2 = _mm256_gf2p8affine_epi64_epi8(data, matSwapA, 0);
 			
 			if(srcCount >= 2) {
-				data = _mm256_load_si256((__m256i*)(_src2 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src2 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormB, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapB, 0));
 			}
 			
 			if(srcCount >= 3) {
-				data = _mm256_load_si256((__m256i*)(_src3 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src3 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormC, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapC, 0));
 			}
 			if(srcCount >= 4) {
-				data = _mm256_load_si256((__m256i*)(_src4 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src4 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormD, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapD, 0));
 			}
 			if(srcCount >= 5) {
-				data = _mm256_load_si256((__m256i*)(_src5 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src5 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormE, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapE, 0));
 			}
 			if(srcCount >= 6) {
-				data = _mm256_load_si256((__m256i*)(_src6 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src6 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormF, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapF, 0));
 			}
 			
-			result1 = _mm256_xor_si256(result1, _mm256_load_si256((__m256i*)(_dst + ptr)));
 			result1 = _mm256_xor_si256(result1, _mm256_shuffle_epi32(result2, _MM_SHUFFLE(1,0,3,2)));
+			if(nt) result1 = gf16_affine2x_join_avx2(result1);
+			if(!doStore)
+				result1 = _mm256_xor_si256(result1, _mm256_load_si256((__m256i*)(_dst + ptr)));
 			_mm256_store_si256((__m256i*)(_dst + ptr), result1);
 			
 			ptr += sizeof(__m256i);
@@ -342,44 +560,78 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx2(
 			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
 		
 		for(int iter=0; iter<(doPrefetch?2:1); iter++) { // if prefetching, iterate on cachelines
-			__m256i data = _mm256_load_si256((__m256i*)(_src1 + ptr*srcScale));
+			__m256i data = gf16_affine2x_load_src_avx2(nt, _src1 + ptr*srcScale);
 			__m256i result1 = _mm256_gf2p8affine_epi64_epi8(data, matNormA, 0);
 			__m256i result2 = _mm256_gf2p8affine_epi64_epi8(data, matSwapA, 0);
 			
 			if(srcCount >= 2) {
-				data = _mm256_load_si256((__m256i*)(_src2 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src2 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormB, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapB, 0));
 			}
 			if(srcCount >= 3) {
-				data = _mm256_load_si256((__m256i*)(_src3 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src3 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormC, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapC, 0));
 			}
 			if(srcCount >= 4) {
-				data = _mm256_load_si256((__m256i*)(_src4 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src4 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormD, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapD, 0));
 			}
 			if(srcCount >= 5) {
-				data = _mm256_load_si256((__m256i*)(_src5 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src5 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormE, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapE, 0));
 			}
 			if(srcCount >= 6) {
-				data = _mm256_load_si256((__m256i*)(_src6 + ptr*srcScale));
+				data = gf16_affine2x_load_src_avx2(nt, _src6 + ptr*srcScale);
 				result1 = _mm256_xor_si256(result1, _mm256_gf2p8affine_epi64_epi8(data, matNormF, 0));
 				result2 = _mm256_xor_si256(result2, _mm256_gf2p8affine_epi64_epi8(data, matSwapF, 0));
 			}
 			
-			result1 = _mm256_xor_si256(result1, _mm256_load_si256((__m256i*)(_dst + ptr)));
 			result1 = _mm256_xor_si256(result1, _mm256_shuffle_epi32(result2, _MM_SHUFFLE(1,0,3,2)));
+			if(nt) result1 = gf16_affine2x_join_avx2(result1);
+			if(!doStore)
+				result1 = _mm256_xor_si256(result1, _mm256_load_si256((__m256i*)(_dst + ptr)));
 			_mm256_store_si256((__m256i*)(_dst + ptr), result1);
 			
 			ptr += sizeof(__m256i);
 		}
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx2(0, 0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_xexp_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx2(1, 0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_nt_muladd_x_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx2(0, 1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_nt_muladd_xexp_avx2(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx2(1, 1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__AVX2__)*/
 
 void gf16_affine2x_muladd_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -409,6 +661,23 @@ unsigned gf16_affine2x_muladd_multi_avx2(const void *HEDLEY_RESTRICT scratch, un
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_avx2, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_avx2, 2, regions, offset, dst, src, len, coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine2x_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX2__)
@@ -426,6 +695,92 @@ unsigned gf16_affine2x_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scra
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine2x_add_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_muladd_single(NULL, &gf16_add_x_block1_avx2, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block1_avx2, 6, regions, offset, dst, src, len, NULL);
+# else
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block1_avx2, 2, regions, offset, dst, src, len, NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_store_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block1_avx2, 6, regions, offset, dst, src, len, NULL);
+# else
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block1_avx2, 2, regions, offset, dst, src, len, NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_avx2, 6, regions, dst, src, len, sizeof(__m256i), NULL);
+# else
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_avx2, 2, regions, dst, src, len, sizeof(__m256i), NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_store_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block1_avx2, 6, regions, dst, src, len, sizeof(__m256i), NULL);
+# else
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block1_avx2, 2, regions, dst, src, len, sizeof(__m256i), NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine2x_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX2__)
@@ -440,3 +795,223 @@ void gf16_affine2x_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch,
 #endif
 }
 
+void gf16_affine2x_mul_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_muladd_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx2, 6, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx2, 2, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_mul_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx2, 6, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx2, 2, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+
+// inputs/outputs of the natural byte order variant only need to be interleaved, which is done in blocks matching the 2x variant
+void gf16_affine_nt_prepare_packed_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m256i), &gf16_nt_copy_block_avx2, &gf16_nt_copy_blocku_avx2, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		2
+#endif
+	, NULL, NULL, NULL, NULL, NULL);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+void gf16_affine_nt_prepare_packed_cksum_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	__m256i checksum = _mm256_setzero_si256();
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m256i), &gf16_nt_copy_block_avx2, &gf16_nt_copy_blocku_avx2, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		2
+#endif
+	, &checksum, &gf16_checksum_block_avx2, &gf16_checksum_blocku_avx2, &gf16_checksum_zeroes_avx2, &gf16_checksum_prepare_avx2);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+int gf16_affine_nt_finish_packed_cksum_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t sliceLen, unsigned numOutputs, unsigned outputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__AVX2__)
+	__m256i checksum = _mm256_setzero_si256();
+	int ret = gf16_finish_packed(dst, src, sliceLen, sizeof(__m256i), &gf16_nt_copy_block_avx2, numOutputs, outputNum, chunkLen, 1, &checksum, &gf16_checksum_block_avx2, &gf16_checksum_finish_avx2);
+	_mm256_zeroupper();
+	return ret;
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(sliceLen); UNUSED(numOutputs); UNUSED(outputNum); UNUSED(chunkLen);
+	return 0;
+#endif
+}
+
+void gf16_affine_nt_muladd_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+	gf16_muladd_single(scratch, &gf16_affine_nt_muladd_x_avx2, dst, src, len, coefficient);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+unsigned gf16_affine_nt_muladd_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_muladd_multi(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, offset, dst, src, len, coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_mul_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, offset, dst, src, len, coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi_packed(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_muladd_multi_packed(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_mul_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_nt_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_mul_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf(scratch, &gf16_affine_nt_muladd_x_avx2, 6, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf(scratch, &gf16_affine_nt_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_muladd_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_avx2, 6, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_avx2, 2, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_mul_multi_packpf_exp_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX2__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_avx2, 6, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_avx2, 2, regions, dst, src, len, sizeof(__m256i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
@@ -19,6 +19,7 @@ int gf16_affine_available_avx512 = 0;
 #endif
 
 #include "gf16_affine2x_x86.h"
+#include "gf16_add_x86.h"
 #ifdef _AVAILABLE
 # undef _AVAILABLE
 #endif
@@ -104,6 +105,17 @@ static HEDLEY_ALWAYS_INLINE __m512i gf16_affine_load2_matrix(const void *HEDLEY_
 	);
 	return depmask;
 }
+// as above, but if expanded is set, coefficients points to matrices previously generated by gf16_affine_expand_avx512, instead of regular coefficients
+static HEDLEY_ALWAYS_INLINE __m256i gf16_affine_load_matrix_x(const int expanded, const void *HEDLEY_RESTRICT scratch, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned idx) {
+	if(expanded)
+		return _mm256_load_si256((const __m256i*)coefficients + idx);
+	return gf16_affine_load_matrix(scratch, coefficients[idx]);
+}
+static HEDLEY_ALWAYS_INLINE __m512i gf16_affine_load2_matrix_x(const int expanded, const void *HEDLEY_RESTRICT scratch, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned idx) {
+	if(expanded)
+		return _mm512_loadu_si512((const __m256i*)coefficients + idx);
+	return gf16_affine_load2_matrix(scratch, coefficients[idx], coefficients[idx+1]);
+}
 #endif
 
 void gf16_affine_mul_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -163,9 +175,9 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_round(const __m512i* src, __
 	);
 }
 #include "gf16_muladd_multi.h"
-static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx512(
-	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_common_avx512(
+	const int expanded, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST,
 	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
@@ -193,34 +205,34 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx512(
 	__m256i depmask256;
 	__m512i depmask1, depmask2;
 	if(srcCount == 1) {
-		depmask256 = gf16_affine_load_matrix(scratch, coefficients[0]);
+		depmask256 = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 0);
 		depmask2 = _mm512_castsi256_si512(depmask256);
 		depmask2 = _mm512_shuffle_i64x2(depmask2, depmask2, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_A, _mm256_castsi256_si128(depmask256));
 	} else if(srcCount > 1) {
-		depmask1 = gf16_affine_load2_matrix(scratch, coefficients[0], coefficients[1]);
+		depmask1 = gf16_affine_load2_matrix_x(expanded, scratch, coefficients, 0);
 		depmask2 = _mm512_shuffle_i64x2(depmask1, depmask1, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_A, _mm512_castsi512_si128(depmask1));
 		PERM2(mat_B);
 	}
 	if(srcCount == 3) {
-		depmask256 = gf16_affine_load_matrix(scratch, coefficients[2]);
+		depmask256 = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 2);
 		depmask2 = _mm512_castsi256_si512(depmask256);
 		depmask2 = _mm512_shuffle_i64x2(depmask2, depmask2, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_C, _mm256_castsi256_si128(depmask256));
 	} else if(srcCount > 3) {
-		depmask1 = gf16_affine_load2_matrix(scratch, coefficients[2], coefficients[3]);
+		depmask1 = gf16_affine_load2_matrix_x(expanded, scratch, coefficients, 2);
 		depmask2 = _mm512_shuffle_i64x2(depmask1, depmask1, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_C, _mm512_castsi512_si128(depmask1));
 		PERM2(mat_D);
 	}
 	if(srcCount == 5) {
-		depmask256 = gf16_affine_load_matrix(scratch, coefficients[4]);
+		depmask256 = gf16_affine_load_matrix_x(expanded, scratch, coefficients, 4);
 		depmask2 = _mm512_castsi256_si512(depmask256);
 		depmask2 = _mm512_shuffle_i64x2(depmask2, depmask2, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_E, _mm256_castsi256_si128(depmask256));
 	} else if(srcCount > 5) {
-		depmask1 = gf16_affine_load2_matrix(scratch, coefficients[4], coefficients[5]);
+		depmask1 = gf16_affine_load2_matrix_x(expanded, scratch, coefficients, 4);
 		depmask2 = _mm512_shuffle_i64x2(depmask1, depmask1, _MM_SHUFFLE(0,1,0,1));
 		PERM1(mat_E, _mm512_castsi512_si128(depmask1));
 		PERM2(mat_F);
@@ -229,8 +241,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx512(
 	#undef PERM2
 	
 	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m512i)*2) {
-		__m512i tph = _mm512_load_si512((__m512i*)(_dst + ptr));
-		__m512i tpl = _mm512_load_si512((__m512i*)(_dst + ptr) + 1);
+		__m512i tph = doStore ? _mm512_setzero_si512() : _mm512_load_si512((__m512i*)(_dst + ptr));
+		__m512i tpl = doStore ? _mm512_setzero_si512() : _mm512_load_si512((__m512i*)(_dst + ptr) + 1);
 		gf16_affine_muladd_round((__m512i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 		if(srcCount >= 2)
 			gf16_affine_muladd_round((__m512i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -251,6 +263,22 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx512(
 			_mm_prefetch(_pf+(ptr>>1), _MM_HINT_T1);
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_avx512(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_avx512(0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_xexp_avx512(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_avx512(1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)*/
 
 void gf16_affine_muladd_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -273,6 +301,69 @@ void gf16_affine_muladd_prefetch_avx512(const void *HEDLEY_RESTRICT scratch, voi
 #endif
 }
 
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+// dst[n] (^)= coefficient^(n+1) * src; the running product stays in registers between outputs
+static HEDLEY_ALWAYS_INLINE void gf16_affine_pow_x_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, const int doAdd) {
+	__m256i depmask = gf16_affine_load_matrix(scratch, coefficient);
+	
+	__m512i mat_ll, mat_lh, mat_hl, mat_hh;
+	__m512i depmask2 = _mm512_castsi256_si512(depmask);
+	depmask2 = _mm512_shuffle_i64x2(depmask2, depmask2, _MM_SHUFFLE(0,1,0,1)); // reverse order to allow more abuse of VBROADCASTQ
+	mat_hh = _mm512_permutex_epi64(depmask2, _MM_SHUFFLE(3,3,3,3));
+	mat_lh = _mm512_permutex_epi64(depmask2, _MM_SHUFFLE(1,1,1,1));
+	mat_ll = _mm512_broadcastq_epi64(_mm256_castsi256_si128(depmask));
+	mat_hl = _mm512_broadcastq_epi64(_mm512_castsi512_si128(depmask2));
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m512i)*2) {
+		__m512i ta = _mm512_load_si512((__m512i*)(_src + ptr));
+		__m512i tb = _mm512_load_si512((__m512i*)(_src + ptr) + 1);
+		for(unsigned output = 0; output < outputs; output++) {
+			__m512i tpl = _mm512_xor_si512(
+				_mm512_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+				_mm512_gf2p8affine_epi64_epi8(tb, mat_ll, 0)
+			);
+			ta = _mm512_xor_si512(
+				_mm512_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+				_mm512_gf2p8affine_epi64_epi8(tb, mat_hl, 0)
+			);
+			tb = tpl;
+			
+			__m512i* _dst = (__m512i*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_mm512_store_si512(_dst, _mm512_xor_si512(ta, _mm512_load_si512(_dst)));
+				_mm512_store_si512(_dst + 1, _mm512_xor_si512(tb, _mm512_load_si512(_dst + 1)));
+			} else {
+				_mm512_store_si512(_dst, ta);
+				_mm512_store_si512(_dst + 1, tb);
+			}
+		}
+	}
+}
+#endif
+
+void gf16_affine_pow_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_affine_pow_x_avx512(scratch, outputs, offset, dst, src, len, coefficient, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void gf16_affine_pow_add_avx512(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_affine_pow_x_avx512(scratch, outputs, offset, dst, src, len, coefficient, 1);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
@@ -285,6 +376,18 @@ unsigned gf16_affine_muladd_multi_avx512(const void *HEDLEY_RESTRICT scratch, un
 #endif
 }
 
+unsigned gf16_affine_mul_multi_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine_muladd_x_avx512, 6, regions, offset, dst, src, len, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_packed_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
@@ -297,6 +400,71 @@ unsigned gf16_affine_muladd_multi_packed_avx512(const void *HEDLEY_RESTRICT scra
 #endif
 }
 
+unsigned gf16_affine_mul_multi_packed_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine_muladd_x_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_add_avx512(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_muladd_single(NULL, &gf16_add_x_block2_avx512, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine_add_multi_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block2_avx512, 6, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_store_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block2_avx512, 6, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block2_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_store_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block2_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine_muladd_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
@@ -307,6 +475,36 @@ void gf16_affine_muladd_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratch,
 #endif
 }
 
+void gf16_affine_mul_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &gf16_affine_muladd_x_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, coefficients, 1, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_muladd_multi_packpf_exp_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, expCoefficients, sizeof(__m256i), 1, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_mul_multi_packpf_exp_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_avx512, 6, regions, dst, src, len, sizeof(__m512i)*2, expCoefficients, sizeof(__m256i), 1, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
 
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
 # include "gf16_bitdep_init_avx2.h"
@@ -323,6 +521,17 @@ void* gf16_affine_init_avx512(int polynomial) {
 #endif
 }
 
+// computes the matrix for each coefficient, for use with the *_packpf_exp functions; each matrix takes 32 bytes, and dst must be 32-byte aligned
+void gf16_affine_expand_avx512(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	for(unsigned i=0; i<count; i++)
+		_mm256_store_si256((__m256i*)dst + i, gf16_affine_load_matrix(scratch, coefficients[i]));
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(coefficients); UNUSED(count);
+#endif
+}
+
 
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
 static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_2round(const int srcCountOffs, const void* _src1, const void* _src2, __m512i* result, __m512i* swapped, __m512i matNorm1, __m512i matSwap1, __m512i matNorm2, __m512i matSwap2) {
@@ -355,8 +564,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_2round(const int srcCountO
 		);
 	}
 }
-static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx512(
-	const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_common_avx512(
+	const int expanded, const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST,
 	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
@@ -376,82 +585,104 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx512(
 	__m512i matNormK, matSwapK;
 	__m512i matNormL, matSwapL;
 	__m512i matNormM, matSwapM;
-	if(srcCount == 1) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[0]));
-		matNormA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 1) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[0], coefficients[1]);
-		matNormA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormB = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapB = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 3) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[2]));
-		matNormC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 3) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[2], coefficients[3]);
-		matNormC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormD = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapD = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 5) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[4]));
-		matNormE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 5) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[4], coefficients[5]);
-		matNormE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormF = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapF = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 7) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[6]));
-		matNormG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 7) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[6], coefficients[7]);
-		matNormG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormH = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapH = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 9) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[8]));
-		matNormI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 9) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[8], coefficients[9]);
-		matNormI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormJ = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapJ = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 11) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[10]));
-		matNormK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-	}
-	if(srcCount > 11) {
-		depmask = gf16_affine_load2_matrix(scratch, coefficients[10], coefficients[11]);
-		matNormK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
-		matNormL = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
-		matSwapL = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
-	}
-	if(srcCount == 13) {
-		depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[12]));
-		matNormM = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
-		matSwapM = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+	if(expanded) {
+		// pre-expanded matrices can be broadcast straight from memory
+		#define LOAD_EXP(n, idx) if(srcCount > idx) { \
+			matNorm##n = _mm512_broadcast_i32x4(_mm_load_si128((const __m128i*)coefficients + idx*2)); \
+			matSwap##n = _mm512_broadcast_i32x4(_mm_load_si128((const __m128i*)coefficients + idx*2 + 1)); \
+		}
+		LOAD_EXP(A, 0)
+		LOAD_EXP(B, 1)
+		LOAD_EXP(C, 2)
+		LOAD_EXP(D, 3)
+		LOAD_EXP(E, 4)
+		LOAD_EXP(F, 5)
+		LOAD_EXP(G, 6)
+		LOAD_EXP(H, 7)
+		LOAD_EXP(I, 8)
+		LOAD_EXP(J, 9)
+		LOAD_EXP(K, 10)
+		LOAD_EXP(L, 11)
+		LOAD_EXP(M, 12)
+		#undef LOAD_EXP
+	} else {
+		if(srcCount == 1) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[0]));
+			matNormA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 1) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[0], coefficients[1]);
+			matNormA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapA = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormB = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapB = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 3) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[2]));
+			matNormC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 3) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[2], coefficients[3]);
+			matNormC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapC = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormD = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapD = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 5) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[4]));
+			matNormE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 5) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[4], coefficients[5]);
+			matNormE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapE = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormF = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapF = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 7) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[6]));
+			matNormG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 7) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[6], coefficients[7]);
+			matNormG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapG = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormH = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapH = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 9) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[8]));
+			matNormI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 9) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[8], coefficients[9]);
+			matNormI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapI = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormJ = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapJ = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 11) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[10]));
+			matNormK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
+		if(srcCount > 11) {
+			depmask = gf16_affine_load2_matrix(scratch, coefficients[10], coefficients[11]);
+			matNormK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapK = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+			matNormL = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(2,2,2,2));
+			matSwapL = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(3,3,3,3));
+		}
+		if(srcCount == 13) {
+			depmask = _mm512_castsi256_si512(gf16_affine_load_matrix(scratch, coefficients[12]));
+			matNormM = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(0,0,0,0));
+			matSwapM = _mm512_shuffle_i64x2(depmask, depmask, _MM_SHUFFLE(1,1,1,1));
+		}
 	}
 	
 	
@@ -492,12 +723,15 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx512(
 		gf16_affine2x_muladd_2round(srcCount - 10, _src10 + ptr*srcScale, _src11 + ptr*srcScale, &result, &swapped, matNormJ, matSwapJ, matNormK, matSwapK);
 		gf16_affine2x_muladd_2round(srcCount - 12, _src12 + ptr*srcScale, _src13 + ptr*srcScale, &result, &swapped, matNormL, matSwapL, matNormM, matSwapM);
 		
-		result = _mm512_ternarylogic_epi32(
-			result,
-			_mm512_shuffle_epi32(swapped, _MM_SHUFFLE(1,0,3,2)),
-			_mm512_load_si512((__m512i*)(_dst + ptr)),
-			0x96
-		);
+		if(doStore)
+			result = _mm512_xor_si512(result, _mm512_shuffle_epi32(swapped, _MM_SHUFFLE(1,0,3,2)));
+		else
+			result = _mm512_ternarylogic_epi32(
+				result,
+				_mm512_shuffle_epi32(swapped, _MM_SHUFFLE(1,0,3,2)),
+				_mm512_load_si512((__m512i*)(_dst + ptr)),
+				0x96
+			);
 		_mm512_store_si512 ((__m512i*)(_dst + ptr), result);
 		
 		if(doPrefetch == 1)
@@ -506,6 +740,20 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx512(
 			_mm_prefetch(_pf+ptr, _MM_HINT_T1);
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_avx512(
+	const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx512(0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_xexp_avx512(
+	const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_avx512(1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)*/
 
 
@@ -538,6 +786,24 @@ unsigned gf16_affine2x_muladd_multi_avx512(const void *HEDLEY_RESTRICT scratch,
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	// TODO: review max number of regions
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_avx512, 10, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_avx512, 2, regions, offset, dst, src, len, coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine2x_muladd_multi_packed_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
@@ -555,6 +821,92 @@ unsigned gf16_affine2x_muladd_multi_packed_avx512(const void *HEDLEY_RESTRICT sc
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_packed_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_avx512, 12, regions, dst, src, len, sizeof(__m512i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_avx512, 2, regions, dst, src, len, sizeof(__m512i), coefficients);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine2x_add_avx512(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	gf16_muladd_single(NULL, &gf16_add_x_block1_avx512, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block1_avx512, 10, regions, offset, dst, src, len, NULL);
+# else
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block1_avx512, 2, regions, offset, dst, src, len, NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_store_avx512(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block1_avx512, 10, regions, offset, dst, src, len, NULL);
+# else
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block1_avx512, 2, regions, offset, dst, src, len, NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_avx512, 12, regions, dst, src, len, sizeof(__m512i), NULL);
+# else
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_avx512, 2, regions, dst, src, len, sizeof(__m512i), NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_store_avx512(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block1_avx512, 12, regions, dst, src, len, sizeof(__m512i), NULL);
+# else
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block1_avx512, 2, regions, dst, src, len, sizeof(__m512i), NULL);
+# endif
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine2x_muladd_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
@@ -568,3 +920,45 @@ void gf16_affine2x_muladd_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratc
 	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
 #endif
 }
+
+void gf16_affine2x_mul_multi_packpf_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_avx512, 12, regions, dst, src, len, sizeof(__m512i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_avx512, 2, regions, dst, src, len, sizeof(__m512i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_muladd_multi_packpf_exp_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx512, 12, regions, dst, src, len, sizeof(__m512i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx512, 2, regions, dst, src, len, sizeof(__m512i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_mul_multi_packpf_exp_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx512, 12, regions, dst, src, len, sizeof(__m512i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_avx512, 2, regions, dst, src, len, sizeof(__m512i), expCoefficients, sizeof(__m256i), 0, prefetchIn, prefetchOut);
+# endif
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
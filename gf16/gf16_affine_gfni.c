@@ -20,6 +20,7 @@ int gf16_affine_available_gfni = 0;
 #endif
 
 #include "gf16_affine2x_x86.h"
+#include "gf16_add_x86.h"
 #ifdef _AVAILABLE
 # undef _AVAILABLE
 #endif
@@ -71,6 +72,14 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_load_matrix(const void *HEDLEY_REST
 	*depmask1 = _mm_xor_si128(*depmask1, _mm_load_si128((__m128i*)((char*)scratch + ((coefficient >> 5) & 0x780)) + 3*2));
 	*depmask2 = _mm_xor_si128(*depmask2, _mm_load_si128((__m128i*)((char*)scratch + ((coefficient >> 5) & 0x780)) + 3*2 +1));
 }
+// as above, but if expanded is set, coefficients points to matrices previously generated by gf16_affine_expand_gfni, instead of regular coefficients
+static HEDLEY_ALWAYS_INLINE void gf16_affine_load_matrix_x(const int expanded, const void *HEDLEY_RESTRICT scratch, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned idx, __m128i* depmask1, __m128i* depmask2) {
+	if(expanded) {
+		*depmask1 = _mm_load_si128((const __m128i*)coefficients + idx*2);
+		*depmask2 = _mm_load_si128((const __m128i*)coefficients + idx*2 +1);
+	} else
+		gf16_affine_load_matrix(scratch, coefficients[idx], depmask1, depmask2);
+}
 #endif
 
 void gf16_affine_mul_gfni(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -119,16 +128,16 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_round(const __m128i* src, __
 	*tph = _mm_xor_si128(*tph, _mm_gf2p8affine_epi64_epi8(tb, mat_hl, 0));
 }
 #include "gf16_muladd_multi.h"
-static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
-	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_common_gfni(
+	const int expanded, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST, size_t len,
 	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
 	GF16_MULADD_MULTI_SRC_UNUSED(3);
 	__m128i depmask1, depmask2;
 	
-	gf16_affine_load_matrix(scratch, coefficients[0], &depmask1, &depmask2);
+	gf16_affine_load_matrix_x(expanded, scratch, coefficients, 0, &depmask1, &depmask2);
 	__m128i mat_All = _mm_shuffle_epi32(depmask1, _MM_SHUFFLE(1,0,1,0));
 	__m128i mat_Ahh = _mm_unpackhi_epi64(depmask1, depmask1);
 	__m128i mat_Ahl = _mm_shuffle_epi32(depmask2, _MM_SHUFFLE(1,0,1,0));
@@ -136,7 +145,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 	
 	__m128i mat_Bll, mat_Bhh, mat_Bhl, mat_Blh;
 	if(srcCount >= 2) {
-		gf16_affine_load_matrix(scratch, coefficients[1], &depmask1, &depmask2);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 1, &depmask1, &depmask2);
 		mat_Bll = _mm_shuffle_epi32(depmask1, _MM_SHUFFLE(1,0,1,0));
 		mat_Bhh = _mm_unpackhi_epi64(depmask1, depmask1);
 		mat_Bhl = _mm_shuffle_epi32(depmask2, _MM_SHUFFLE(1,0,1,0));
@@ -145,7 +154,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 	
 	__m128i mat_Cll, mat_Chh, mat_Chl, mat_Clh;
 	if(srcCount > 2) {
-		gf16_affine_load_matrix(scratch, coefficients[2], &depmask1, &depmask2);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 2, &depmask1, &depmask2);
 		mat_Cll = _mm_shuffle_epi32(depmask1, _MM_SHUFFLE(1,0,1,0));
 		mat_Chh = _mm_unpackhi_epi64(depmask1, depmask1);
 		mat_Chl = _mm_shuffle_epi32(depmask2, _MM_SHUFFLE(1,0,1,0));
@@ -156,8 +165,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 	if(doPrefetch) {
 		intptr_t ptr = -(intptr_t)len;
 		if(len & (sizeof(__m128i)*4-1)) { // number of loop iterations isn't even, so do one iteration to make it even
-			tph = _mm_load_si128((__m128i*)(_dst + ptr));
-			tpl = _mm_load_si128((__m128i*)(_dst + ptr) + 1);
+			tph = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr));
+			tpl = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr) + 1);
 			gf16_affine_muladd_round((__m128i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 			if(srcCount > 1)
 				gf16_affine_muladd_round((__m128i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -173,8 +182,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 			ptr += sizeof(__m128i)*2;
 		}
 		while(ptr) {
-			tph = _mm_load_si128((__m128i*)(_dst + ptr));
-			tpl = _mm_load_si128((__m128i*)(_dst + ptr) + 1);
+			tph = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr));
+			tpl = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr) + 1);
 			gf16_affine_muladd_round((__m128i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 			if(srcCount > 1)
 				gf16_affine_muladd_round((__m128i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -185,8 +194,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 			
 			ptr += sizeof(__m128i)*2;
 			
-			tph = _mm_load_si128((__m128i*)(_dst + ptr));
-			tpl = _mm_load_si128((__m128i*)(_dst + ptr) + 1);
+			tph = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr));
+			tpl = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr) + 1);
 			gf16_affine_muladd_round((__m128i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 			if(srcCount > 1)
 				gf16_affine_muladd_round((__m128i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -203,8 +212,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 		}
 	} else {
 		for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m128i)*2) {
-			tph = _mm_load_si128((__m128i*)(_dst + ptr));
-			tpl = _mm_load_si128((__m128i*)(_dst + ptr) + 1);
+			tph = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr));
+			tpl = doStore ? _mm_setzero_si128() : _mm_load_si128((__m128i*)(_dst + ptr) + 1);
 			gf16_affine_muladd_round((__m128i*)(_src1 + ptr*srcScale), &tpl, &tph, mat_All, mat_Ahl, mat_Alh, mat_Ahh);
 			if(srcCount > 1)
 				gf16_affine_muladd_round((__m128i*)(_src2 + ptr*srcScale), &tpl, &tph, mat_Bll, mat_Bhl, mat_Blh, mat_Bhh);
@@ -215,6 +224,22 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
 		}
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_x_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_gfni(0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_muladd_xexp_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine_muladd_x_common_gfni(1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__SSSE3__)*/
 
 
@@ -236,6 +261,65 @@ void gf16_affine_muladd_prefetch_gfni(const void *HEDLEY_RESTRICT scratch, void
 #endif
 }
 
+#if defined(__GFNI__) && defined(__SSSE3__)
+// powers are chained in registers: each product is fed back in as the source for the next output
+static HEDLEY_ALWAYS_INLINE void gf16_affine_pow_x_gfni(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, const int doAdd) {
+	__m128i depmask1, depmask2;
+	gf16_affine_load_matrix(scratch, coefficient, &depmask1, &depmask2);
+	
+	__m128i mat_ll = _mm_shuffle_epi32(depmask1, _MM_SHUFFLE(1,0,1,0)); // allows src+dst in SSE encoding
+	__m128i mat_hh = _mm_unpackhi_epi64(depmask1, depmask1);            // shorter instruction than above, but destructive
+	__m128i mat_hl = _mm_shuffle_epi32(depmask2, _MM_SHUFFLE(1,0,1,0));
+	__m128i mat_lh = _mm_unpackhi_epi64(depmask2, depmask2);
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m128i)*2) {
+		__m128i ta = _mm_load_si128((__m128i*)(_src + ptr));
+		__m128i tb = _mm_load_si128((__m128i*)(_src + ptr) + 1);
+		for(unsigned output = 0; output < outputs; output++) {
+			__m128i tpl = _mm_xor_si128(
+				_mm_gf2p8affine_epi64_epi8(ta, mat_lh, 0),
+				_mm_gf2p8affine_epi64_epi8(tb, mat_ll, 0)
+			);
+			ta = _mm_xor_si128(
+				_mm_gf2p8affine_epi64_epi8(ta, mat_hh, 0),
+				_mm_gf2p8affine_epi64_epi8(tb, mat_hl, 0)
+			);
+			tb = tpl;
+			
+			__m128i* _dst = (__m128i*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_mm_store_si128(_dst, _mm_xor_si128(ta, _mm_load_si128(_dst)));
+				_mm_store_si128(_dst + 1, _mm_xor_si128(tb, _mm_load_si128(_dst + 1)));
+			} else {
+				_mm_store_si128(_dst, ta);
+				_mm_store_si128(_dst + 1, tb);
+			}
+		}
+	}
+}
+#endif
+
+void gf16_affine_pow_gfni(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_affine_pow_x_gfni(scratch, outputs, offset, dst, src, len, coefficient, 0);
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void gf16_affine_pow_add_gfni(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_affine_pow_x_gfni(scratch, outputs, offset, dst, src, len, coefficient, 1);
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
@@ -246,6 +330,16 @@ unsigned gf16_affine_muladd_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsi
 #endif
 }
 
+unsigned gf16_affine_mul_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_mul_multi(scratch, &gf16_affine_muladd_x_gfni, 3, regions, offset, dst, src, len, coefficients);
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine_muladd_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
@@ -256,6 +350,60 @@ unsigned gf16_affine_muladd_multi_packed_gfni(const void *HEDLEY_RESTRICT scratc
 #endif
 }
 
+unsigned gf16_affine_mul_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_mul_multi_packed(scratch, &gf16_affine_muladd_x_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, coefficients);
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_add_gfni(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_muladd_single(NULL, &gf16_add_x_block2_gfni, dst, src, len, 0);
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine_add_multi_gfni(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_muladd_multi(NULL, &gf16_add_x_block2_gfni, 3, regions, offset, dst, src, len, NULL);
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_store_gfni(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_mul_multi(NULL, &gf16_add_x_block2_gfni, 3, regions, offset, dst, src, len, NULL);
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_gfni(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_muladd_multi_packed(NULL, &gf16_add_x_block2_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, NULL);
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_add_multi_packed_store_gfni(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	return gf16_mul_multi_packed(NULL, &gf16_add_x_block2_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, NULL);
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine_muladd_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
@@ -265,6 +413,33 @@ void gf16_affine_muladd_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, u
 #endif
 }
 
+void gf16_affine_mul_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &gf16_affine_muladd_x_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, coefficients, 0, prefetchIn, prefetchOut);
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_muladd_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_mul_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_muladd_xexp_gfni, 3, regions, dst, src, len, sizeof(__m128i)*2, expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
 
 #include "gf16_bitdep_init_sse2.h"
 void* gf16_affine_init_gfni(int polynomial) {
@@ -279,12 +454,35 @@ void* gf16_affine_init_gfni(int polynomial) {
 #endif
 }
 
+// computes the matrix for each coefficient, for use with the *_packpf_exp functions; each matrix takes 32 bytes, and dst must be 32-byte aligned
+void gf16_affine_expand_gfni(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	for(unsigned i=0; i<count; i++) {
+		__m128i depmask1, depmask2;
+		gf16_affine_load_matrix(scratch, coefficients[i], &depmask1, &depmask2);
+		_mm_store_si128((__m128i*)dst + i*2, depmask1);
+		_mm_store_si128((__m128i*)dst + i*2 +1, depmask2);
+	}
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(coefficients); UNUSED(count);
+#endif
+}
+
 
 
 #if defined(__GFNI__) && defined(__SSSE3__)
-static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_gfni(
-	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+// for the natural byte order variant, split bytes into the 2x layout when loading, and join them back before writing out
+static HEDLEY_ALWAYS_INLINE __m128i gf16_affine2x_load_src_gfni(const int nt, const uint8_t* src) {
+	__m128i data = _mm_load_si128((__m128i*)src);
+	if(nt) data = _mm_shuffle_epi8(data, _mm_set_epi32(0x0f0d0b09, 0x07050301, 0x0e0c0a08, 0x06040200));
+	return data;
+}
+static HEDLEY_ALWAYS_INLINE __m128i gf16_affine2x_join_gfni(__m128i data) {
+	return _mm_shuffle_epi8(data, _mm_set_epi32(0x0f070e06, 0x0d050c04, 0x0b030a02, 0x09010800));
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_common_gfni(
+	const int expanded, const int nt, const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST,
 	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
@@ -296,17 +494,17 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_gfni(
 	__m128i matNormD, matSwapD;
 	__m128i matNormE, matSwapE;
 	__m128i matNormF, matSwapF;
-	gf16_affine_load_matrix(scratch, coefficients[0], &matNormA, &matSwapA);
+	gf16_affine_load_matrix_x(expanded, scratch, coefficients, 0, &matNormA, &matSwapA);
 	if(srcCount >= 2)
-		gf16_affine_load_matrix(scratch, coefficients[1], &matNormB, &matSwapB);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 1, &matNormB, &matSwapB);
 	if(srcCount >= 3)
-		gf16_affine_load_matrix(scratch, coefficients[2], &matNormC, &matSwapC);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 2, &matNormC, &matSwapC);
 	if(srcCount >= 4)
-		gf16_affine_load_matrix(scratch, coefficients[3], &matNormD, &matSwapD);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 3, &matNormD, &matSwapD);
 	if(srcCount >= 5)
-		gf16_affine_load_matrix(scratch, coefficients[4], &matNormE, &matSwapE);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 4, &matNormE, &matSwapE);
 	if(srcCount >= 6)
-		gf16_affine_load_matrix(scratch, coefficients[5], &matNormF, &matSwapF);
+		gf16_affine_load_matrix_x(expanded, scratch, coefficients, 5, &matNormF, &matSwapF);
 	
 	
 	intptr_t ptr = -(intptr_t)len;
@@ -316,39 +514,41 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_gfni(
 		if(doPrefetch == 2)
 			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
 		while(ptr & (sizeof(__m128i)*4-1)) { // loop until we reach a cacheline boundary
-			__m128i data = _mm_load_si128((__m128i*)(_src1 + ptr*srcScale));
+			__m128i data = gf16_affine2x_load_src_gfni(nt, _src1 + ptr*srcScale);
 			__m128i result1 = _mm_gf2p8affine_epi64_epi8(data, matNormA, 0);
 			__m128i result2 = _mm_gf2p8affine_epi64_epi8(data, matSwapA, 0);
 			
 			if(srcCount >= 2) {
-				data = _mm_load_si128((__m128i*)(_src2 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src2 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormB, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapB, 0));
 			}
 			
 			if(srcCount >= 3) {
-				data = _mm_load_si128((__m128i*)(_src3 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src3 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormC, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapC, 0));
 			}
 			if(srcCount >= 4) {
-				data = _mm_load_si128((__m128i*)(_src4 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src4 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormD, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapD, 0));
 			}
 			if(srcCount >= 5) {
-				data = _mm_load_si128((__m128i*)(_src5 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src5 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormE, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapE, 0));
 			}
 			if(srcCount >= 6) {
-				data = _mm_load_si128((__m128i*)(_src6 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src6 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormF, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapF, 0));
 			}
 			
-			result1 = _mm_xor_si128(result1, _mm_load_si128((__m128i*)(_dst + ptr)));
 			result1 = _mm_xor_si128(result1, _mm_shuffle_epi32(result2, _MM_SHUFFLE(1,0,3,2)));
+			if(nt) result1 = gf16_affine2x_join_gfni(result1);
+			if(!doStore)
+				result1 = _mm_xor_si128(result1, _mm_load_si128((__m128i*)(_dst + ptr)));
 			_mm_store_si128((__m128i*)(_dst + ptr), result1);
 			
 			ptr += sizeof(__m128i);
@@ -361,44 +561,78 @@ static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_gfni(
 			_mm_prefetch(_pf+ptr, _MM_HINT_T2);
 		
 		for(int iter=0; iter<(doPrefetch?4:1); iter++) { // if prefetching, iterate on cachelines
-			__m128i data = _mm_load_si128((__m128i*)(_src1 + ptr*srcScale));
+			__m128i data = gf16_affine2x_load_src_gfni(nt, _src1 + ptr*srcScale);
 			__m128i result1 = _mm_gf2p8affine_epi64_epi8(data, matNormA, 0);
 			__m128i result2 = _mm_gf2p8affine_epi64_epi8(data, matSwapA, 0);
 			
 			if(srcCount >= 2) {
-				data = _mm_load_si128((__m128i*)(_src2 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src2 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormB, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapB, 0));
 			}
 			if(srcCount >= 3) {
-				data = _mm_load_si128((__m128i*)(_src3 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src3 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormC, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapC, 0));
 			}
 			if(srcCount >= 4) {
-				data = _mm_load_si128((__m128i*)(_src4 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src4 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormD, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapD, 0));
 			}
 			if(srcCount >= 5) {
-				data = _mm_load_si128((__m128i*)(_src5 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src5 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormE, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapE, 0));
 			}
 			if(srcCount >= 6) {
-				data = _mm_load_si128((__m128i*)(_src6 + ptr*srcScale));
+				data = gf16_affine2x_load_src_gfni(nt, _src6 + ptr*srcScale);
 				result1 = _mm_xor_si128(result1, _mm_gf2p8affine_epi64_epi8(data, matNormF, 0));
 				result2 = _mm_xor_si128(result2, _mm_gf2p8affine_epi64_epi8(data, matSwapF, 0));
 			}
 			
-			result1 = _mm_xor_si128(result1, _mm_load_si128((__m128i*)(_dst + ptr)));
 			result1 = _mm_xor_si128(result1, _mm_shuffle_epi32(result2, _MM_SHUFFLE(1,0,3,2)));
+			if(nt) result1 = gf16_affine2x_join_gfni(result1);
+			if(!doStore)
+				result1 = _mm_xor_si128(result1, _mm_load_si128((__m128i*)(_dst + ptr)));
 			_mm_store_si128((__m128i*)(_dst + ptr), result1);
 			
 			ptr += sizeof(__m128i);
 		}
 	}
 }
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_x_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_gfni(0, 0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine2x_muladd_xexp_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_gfni(1, 0, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_nt_muladd_x_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_gfni(0, 1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_affine_nt_muladd_xexp_gfni(
+	const void *HEDLEY_RESTRICT scratch,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST,
+	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
+) {
+	gf16_affine2x_muladd_x_common_gfni(1, 1, scratch, _dst, srcScale, doStore, GF16_MULADD_MULTI_SRCLIST_FWD, len, coefficients, doPrefetch, _pf);
+}
 #endif /*defined(__GFNI__) && defined(__SSSE3__)*/
 
 void gf16_affine2x_muladd_gfni(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
@@ -425,6 +659,21 @@ unsigned gf16_affine2x_muladd_multi_gfni(const void *HEDLEY_RESTRICT scratch, un
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_gfni, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_mul_multi(scratch, &gf16_affine2x_muladd_x_gfni, 2, regions, offset, dst, src, len, coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_affine2x_muladd_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__SSSE3__)
@@ -440,6 +689,81 @@ unsigned gf16_affine2x_muladd_multi_packed_gfni(const void *HEDLEY_RESTRICT scra
 #endif
 }
 
+unsigned gf16_affine2x_mul_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_mul_multi_packed(scratch, &gf16_affine2x_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine2x_add_gfni(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_muladd_single(NULL, &gf16_add_x_block1_gfni, dst, src, len, 0);
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_gfni(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_muladd_multi(NULL, &gf16_add_x_block1_gfni, 6, regions, offset, dst, src, len, NULL);
+# else
+	return gf16_muladd_multi(NULL, &gf16_add_x_block1_gfni, 2, regions, offset, dst, src, len, NULL);
+# endif
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_store_gfni(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi(NULL, &gf16_add_x_block1_gfni, 6, regions, offset, dst, src, len, NULL);
+# else
+	return gf16_mul_multi(NULL, &gf16_add_x_block1_gfni, 2, regions, offset, dst, src, len, NULL);
+# endif
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_gfni(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_gfni, 6, regions, dst, src, len, sizeof(__m128i), NULL);
+# else
+	return gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_gfni, 2, regions, dst, src, len, sizeof(__m128i), NULL);
+# endif
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine2x_add_multi_packed_store_gfni(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi_packed(NULL, &gf16_add_x_block1_gfni, 6, regions, dst, src, len, sizeof(__m128i), NULL);
+# else
+	return gf16_mul_multi_packed(NULL, &gf16_add_x_block1_gfni, 2, regions, dst, src, len, sizeof(__m128i), NULL);
+# endif
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_affine2x_muladd_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(__GFNI__) && defined(__SSSE3__)
@@ -453,3 +777,204 @@ void gf16_affine2x_muladd_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch,
 #endif
 }
 
+void gf16_affine2x_mul_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf(scratch, &gf16_affine2x_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_muladd_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_gfni, 6, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_gfni, 2, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine2x_mul_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_gfni, 6, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine2x_muladd_xexp_gfni, 2, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+
+// inputs/outputs of the natural byte order variant only need to be interleaved, which is done in blocks matching the 2x variant
+void gf16_affine_nt_prepare_packed_gfni(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m128i), &gf16_nt_copy_block_gfni, &gf16_nt_copy_blocku_gfni, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		2
+#endif
+	, NULL, NULL, NULL, NULL, NULL);
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+void gf16_affine_nt_prepare_packed_cksum_gfni(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	__m128i checksum = _mm_setzero_si128();
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(__m128i), &gf16_nt_copy_block_gfni, &gf16_nt_copy_blocku_gfni, inputPackSize, inputNum, chunkLen,
+#ifdef PLATFORM_AMD64
+		6
+#else
+		2
+#endif
+	, &checksum, &gf16_checksum_block_gfni, &gf16_checksum_blocku_gfni, &gf16_checksum_zeroes_gfni, &gf16_checksum_prepare_gfni);
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+int gf16_affine_nt_finish_packed_cksum_gfni(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t sliceLen, unsigned numOutputs, unsigned outputNum, size_t chunkLen) {
+#if defined(__GFNI__) && defined(__SSSE3__)
+	__m128i checksum = _mm_setzero_si128();
+	int ret = gf16_finish_packed(dst, src, sliceLen, sizeof(__m128i), &gf16_nt_copy_block_gfni, numOutputs, outputNum, chunkLen, 1, &checksum, &gf16_checksum_block_gfni, &gf16_checksum_finish_gfni);
+	return ret;
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(sliceLen); UNUSED(numOutputs); UNUSED(outputNum); UNUSED(chunkLen);
+	return 0;
+#endif
+}
+
+void gf16_affine_nt_muladd_gfni(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+	gf16_muladd_single(scratch, &gf16_affine_nt_muladd_x_gfni, dst, src, len, coefficient);
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+unsigned gf16_affine_nt_muladd_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_muladd_multi(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_muladd_multi(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, offset, dst, src, len, coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_mul_multi_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, offset, dst, src, len, coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_mul_multi(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, offset, dst, src, len, coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_muladd_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_muladd_multi_packed(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_muladd_multi_packed(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned gf16_affine_nt_mul_multi_packed_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	return gf16_mul_multi_packed(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients);
+# else
+	// if only 8 registers available, only allow 2 parallel regions
+	return gf16_mul_multi_packed(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_affine_nt_muladd_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_mul_multi_packpf_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf(scratch, &gf16_affine_nt_muladd_x_gfni, 6, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf(scratch, &gf16_affine_nt_muladd_x_gfni, 2, regions, dst, src, len, sizeof(__m128i), coefficients, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_muladd_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_gfni, 6, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# else
+	gf16_muladd_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_gfni, 2, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+void gf16_affine_nt_mul_multi_packpf_exp_gfni(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(__GFNI__) && defined(__SSSE3__)
+# ifdef PLATFORM_AMD64
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_gfni, 6, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# else
+	gf16_mul_multi_packpf_sized(scratch, &gf16_affine_nt_muladd_xexp_gfni, 2, regions, dst, src, len, sizeof(__m128i), expCoefficients, sizeof(__m128i)*2, 0, prefetchIn, prefetchOut);
+# endif
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(expCoefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
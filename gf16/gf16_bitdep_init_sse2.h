@@ -5,6 +5,7 @@
 #define GF16_BITDEP_INIT128_GEN_XOR 0
 #define GF16_BITDEP_INIT128_GEN_XORJIT 1
 #define GF16_BITDEP_INIT128_GEN_AFFINE 2
+#define GF16_BITDEP_INIT128_GEN_XORJIT_AVX 3
 
 
 #ifdef __SSE2__
@@ -21,7 +22,7 @@ static inline void gf16_bitdep128_store(__m128i* dst, __m128i depmask1, __m128i
 		depmask1 = _mm_castps_si128(_mm_shuffle_ps(tmp2, tmp1, _MM_SHUFFLE(3,2,1,0)));
 		depmask2 = _mm_castps_si128(_mm_shuffle_ps(tmp1, tmp2, _MM_SHUFFLE(3,2,1,0)));
 # endif
-	} else if(genMode == GF16_BITDEP_INIT128_GEN_XORJIT) {
+	} else if(genMode == GF16_BITDEP_INIT128_GEN_XORJIT || genMode == GF16_BITDEP_INIT128_GEN_XORJIT_AVX) {
 		/* emulate PACKUSDW (SSE4.1 only) with SSE2 shuffles */
 		/* 01234567 -> 02461357 */
 		__m128i tmp1 = _mm_shuffle_epi32(
@@ -42,6 +43,12 @@ static inline void gf16_bitdep128_store(__m128i* dst, __m128i depmask1, __m128i
 		depmask1 = _mm_unpacklo_epi64(tmp1, tmp2);
 		depmask2 = _mm_unpackhi_epi64(tmp1, tmp2);
 		
+		if(genMode == GF16_BITDEP_INIT128_GEN_XORJIT_AVX) {
+			/* AVX JIT uses the even/odd split as is */
+			_mm_store_si128((__m128i*)dst + 0, depmask1);
+			_mm_store_si128((__m128i*)dst + 1, depmask2);
+			return;
+		}
 		
 		__m128i lmask = _mm_set1_epi8(0xF);
 		
@@ -156,7 +156,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_clmul_neon_reduction(poly16x8_t* low1, pol
 #include "gf16_muladd_multi.h"
 static HEDLEY_ALWAYS_INLINE void gf16_clmul_muladd_x_neon(
 	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, GF16_MULADD_MULTI_SRCLIST, size_t len,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len,
 	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
 	GF16_MULADD_MULTI_SRC_UNUSED(CLMUL_NUM_REGIONS);
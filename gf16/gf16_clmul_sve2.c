@@ -93,7 +93,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_clmul_sve2_reduction(svuint8_t* low1, svui
 #include "gf16_muladd_multi.h"
 static HEDLEY_ALWAYS_INLINE void gf16_clmul_muladd_x_sve2(
 	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, GF16_MULADD_MULTI_SRCLIST, size_t len,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len,
 	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
 	GF16_MULADD_MULTI_SRC_UNUSED(CLMUL_NUM_REGIONS);
@@ -485,7 +485,8 @@ static HEDLEY_ALWAYS_INLINE void calc_2table(uint16_t coefficient, struct gf16_l
 			coefficient4 = GF16_MULTBY_TWO_LOWER_X2(coefficient4);
 		}
 		for (j = 1; j < 32; j++) {
-			uint64_t highVal = (uint64_t)lookup->table2[j] * 0x0001000000010000ULL;
+			// read back via tbl, as reading table2 directly would violate strict aliasing
+			uint64_t highVal = ((tbl[j>>1] >> ((j&1)*32)) & 0xffff) * 0x0001000000010000ULL;
 			for (k = 0; k < 16; k++)
 				tbl[j*16 + k] = tbl[k] | highVal;
 		}
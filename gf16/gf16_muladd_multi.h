@@ -1,7 +1,12 @@
+#ifndef __GF16_MULADD_MULTI_H
+#define __GF16_MULADD_MULTI_H
+
 
 #define GF16_MULADD_MULTI_SRCLIST const int srcCount, \
 	const uint8_t* _src1, const uint8_t* _src2, const uint8_t* _src3, const uint8_t* _src4, const uint8_t* _src5, const uint8_t* _src6, \
 	const uint8_t* _src7, const uint8_t* _src8, const uint8_t* _src9, const uint8_t* _src10, const uint8_t* _src11, const uint8_t* _src12, const uint8_t* _src13
+#define GF16_MULADD_MULTI_SRCLIST_FWD srcCount, \
+	_src1, _src2, _src3, _src4, _src5, _src6, _src7, _src8, _src9, _src10, _src11, _src12, _src13
 #define GF16_MULADD_MULTI_SRC_UNUSED(max) \
 	HEDLEY_ASSUME(srcCount <= max); \
 	if(max < 2) UNUSED(_src2); \
@@ -23,7 +28,7 @@ typedef void (*fMuladdPF)
 #else
 typedef void (*const fMuladdPF)
 #endif
-(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale,
+(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
 	GF16_MULADD_MULTI_SRCLIST,
 	size_t len, const uint16_t *HEDLEY_RESTRICT coefficients,
 	const int doPrefetch, const char* _pf
@@ -32,7 +37,7 @@ typedef void (*const fMuladdPF)
 
 static HEDLEY_ALWAYS_INLINE void gf16_muladd_single(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, uint16_t val) {
 	muladd_pf(
-		scratch, (uint8_t*)dst + len, 1, 1,
+		scratch, (uint8_t*)dst + len, 1, 0, 1,
 		(const uint8_t*)src + len,
 		NULL, NULL, NULL, NULL,
 		NULL, NULL, NULL, NULL,
@@ -43,7 +48,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_single(const void *HEDLEY_RESTRICT
 
 static HEDLEY_ALWAYS_INLINE void gf16_muladd_prefetch_single(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, uint16_t val, const void *HEDLEY_RESTRICT prefetch) {
 	muladd_pf(
-		scratch, (uint8_t*)dst + len, 1, 1,
+		scratch, (uint8_t*)dst + len, 1, 0, 1,
 		(const uint8_t*)src + len,
 		NULL, NULL, NULL, NULL,
 		NULL, NULL, NULL, NULL,
@@ -53,14 +58,15 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_prefetch_single(const void *HEDLEY_
 }
 
 
-static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients) {
+static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_common(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doStore) {
 	uint8_t* _dst = (uint8_t*)dst + offset + len;
 	
 	#define _SRC(limit, n) limit > n ? (const uint8_t*)src[region+n] + offset + len : NULL
+	#define _STORE (doStore && !region)
 	unsigned region = 0;
 	if(regions >= interleave) do {
 		muladd_pf(
-			scratch, _dst, 1, interleave,
+			scratch, _dst, 1, _STORE, interleave,
 			(const uint8_t*)src[region] + offset + len,
 			_SRC(interleave, 1), _SRC(interleave,  2), _SRC(interleave,  3), _SRC(interleave,  4),
 			_SRC(interleave, 5), _SRC(interleave,  6), _SRC(interleave,  7), _SRC(interleave,  8),
@@ -76,7 +82,7 @@ static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi(const void *HEDLEY_RESTRI
 			case x: \
 				if(x >= interleave) HEDLEY_UNREACHABLE(); \
 				muladd_pf( \
-					scratch, _dst, 1, x, \
+					scratch, _dst, 1, _STORE, x, \
 					(const uint8_t*)src[region] + offset + len, \
 					_SRC(x, 1), _SRC(x,  2), _SRC(x,  3), _SRC(x,  4), \
 					_SRC(x, 5), _SRC(x,  6), _SRC(x,  7), _SRC(x,  8), \
@@ -99,19 +105,21 @@ static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi(const void *HEDLEY_RESTRI
 		#undef CASE
 		default: break;
 	}
+	#undef _STORE
 	#undef _SRC
 	return region;
 }
 
 
-static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients) {
+static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed_common(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients, const int doStore) {
 	uint8_t* _dst = (uint8_t*)dst + len;
 	uint8_t* _src = (uint8_t*)src;
+	#define _STORE (doStore && !region)
 	
 	unsigned region = 0;
 	if(regions >= interleave) do {
 		muladd_pf(
-			scratch, _dst, interleave, interleave,
+			scratch, _dst, interleave, _STORE, interleave,
 			_src + region * len + len*interleave,
 			_src + region * len + len*interleave + blockLen*1,
 			_src + region * len + len*interleave + blockLen*2,
@@ -136,7 +144,7 @@ static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed(const void *HEDLEY
 			case x: \
 				if(x >= interleave) HEDLEY_UNREACHABLE(); \
 				muladd_pf( \
-					scratch, _dst, x, x, \
+					scratch, _dst, x, _STORE, x, \
 					_src + region * len + len*x, \
 					_src + region * len + len*x + blockLen*1, \
 					_src + region * len + len*x + blockLen*2, \
@@ -168,6 +176,7 @@ static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed(const void *HEDLEY
 		#undef CASE
 		default: break;
 	}
+	#undef _STORE
 	return region;
 }
 
@@ -177,7 +186,10 @@ static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed(const void *HEDLEY
 # define MM_HINT_WT1 _MM_HINT_ET1
 #endif
 
-static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+// coefficients can either be the regular 16-bit coefficients (coeffSize = 2), or pre-expanded tables of coeffSize bytes per region, in which case the kernel receives a pointer to its first region's table
+static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf_common(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const void *HEDLEY_RESTRICT coefficients, const size_t coeffSize, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut, const int doStore) {
+	#define _COEFF(r) (const uint16_t*)((const uint8_t*)coefficients + (r)*coeffSize)
+	#define _STORE (doStore && !region)
 	uint8_t* _dst = (uint8_t*)dst + len;
 	uint8_t* _src = (uint8_t*)src;
 	
@@ -188,7 +200,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 		unsigned outputPfRounds = 1<<pfFactor;
 		while(outputPfRounds--) {
 			muladd_pf(
-				scratch, _dst, interleave, interleave,
+				scratch, _dst, interleave, _STORE, interleave,
 				_src + region * len + len*interleave,
 				_src + region * len + len*interleave + blockLen*1,
 				_src + region * len + len*interleave + blockLen*2,
@@ -202,7 +214,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 				_src + region * len + len*interleave + blockLen*10,
 				_src + region * len + len*interleave + blockLen*11,
 				_src + region * len + len*interleave + blockLen*12,
-				len, coefficients + region, 1, _pf
+				len, _COEFF(region), 1, _pf
 			);
 			region += interleave;
 			if(outputPfRounds)
@@ -219,7 +231,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 				case x: \
 					if(x > interleave) HEDLEY_UNREACHABLE(); \
 					muladd_pf( \
-						scratch, _dst, x, x, \
+						scratch, _dst, x, _STORE, x, \
 						_src + region * len + len*x, \
 						_src + region * len + len*x + blockLen*1, \
 						_src + region * len + len*x + blockLen*2, \
@@ -233,7 +245,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 						_src + region * len + len*x + blockLen*10, \
 						_src + region * len + len*x + blockLen*11, \
 						_src + region * len + len*x + blockLen*12, \
-						len, coefficients + region, 1, _pf \
+						len, _COEFF(region), 1, _pf \
 					); \
 					region += x; \
 				break
@@ -259,7 +271,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 		_pf = (const char*)prefetchIn + pfLen;
 		while(interleave <= regions - region) {
 			muladd_pf(
-				scratch, _dst, interleave, interleave,
+				scratch, _dst, interleave, _STORE, interleave,
 				_src + region * len + len*interleave,
 				_src + region * len + len*interleave + blockLen*1,
 				_src + region * len + len*interleave + blockLen*2,
@@ -273,7 +285,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 				_src + region * len + len*interleave + blockLen*10,
 				_src + region * len + len*interleave + blockLen*11,
 				_src + region * len + len*interleave + blockLen*12,
-				len, coefficients + region, 2, _pf
+				len, _COEFF(region), 2, _pf
 			);
 			region += interleave;
 			_pf += pfLen;
@@ -281,7 +293,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 	}
 	else while(interleave <= regions - region) {
 		muladd_pf(
-			scratch, _dst, interleave, interleave,
+			scratch, _dst, interleave, _STORE, interleave,
 			_src + region * len + len*interleave,
 			_src + region * len + len*interleave + blockLen*1,
 			_src + region * len + len*interleave + blockLen*2,
@@ -295,7 +307,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 			_src + region * len + len*interleave + blockLen*10,
 			_src + region * len + len*interleave + blockLen*11,
 			_src + region * len + len*interleave + blockLen*12,
-			len, coefficients + region, 0, NULL
+			len, _COEFF(region), 0, NULL
 		);
 		region += interleave;
 	}
@@ -307,7 +319,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 			case x: \
 				if(x > interleave) HEDLEY_UNREACHABLE(); \
 				muladd_pf( \
-					scratch, _dst, x, x, \
+					scratch, _dst, x, _STORE, x, \
 					_src + region * len + len*x, \
 					_src + region * len + len*x + blockLen*1, \
 					_src + region * len + len*x + blockLen*2, \
@@ -321,7 +333,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 					_src + region * len + len*x + blockLen*10, \
 					_src + region * len + len*x + blockLen*11, \
 					_src + region * len + len*x + blockLen*12, \
-					len, coefficients + region, 0, NULL \
+					len, _COEFF(region), 0, NULL \
 				); \
 				region += x; \
 			break
@@ -340,4 +352,38 @@ static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RES
 		#undef CASE
 		default: break;
 	}
+	#undef _STORE
+	#undef _COEFF
 }
+
+// the multi-region functions below either add the products to the destination (muladd), or overwrite it (mul)
+// for the latter, the first kernel invocation gets doStore set, so that it writes its result instead of reading the destination
+static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients) {
+	return gf16_muladd_multi_common(scratch, muladd_pf, interleave, regions, offset, dst, src, len, coefficients, 0);
+}
+static HEDLEY_ALWAYS_INLINE unsigned gf16_mul_multi(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients) {
+	return gf16_muladd_multi_common(scratch, muladd_pf, interleave, regions, offset, dst, src, len, coefficients, 1);
+}
+
+static HEDLEY_ALWAYS_INLINE unsigned gf16_muladd_multi_packed(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients) {
+	return gf16_muladd_multi_packed_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, 0);
+}
+static HEDLEY_ALWAYS_INLINE unsigned gf16_mul_multi_packed(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients) {
+	return gf16_muladd_multi_packed_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, 1);
+}
+
+static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf_sized(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const void *HEDLEY_RESTRICT coefficients, const size_t coeffSize, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	gf16_muladd_multi_packpf_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, coeffSize, pfFactor, prefetchIn, prefetchOut, 0);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_mul_multi_packpf_sized(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const void *HEDLEY_RESTRICT coefficients, const size_t coeffSize, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	gf16_muladd_multi_packpf_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, coeffSize, pfFactor, prefetchIn, prefetchOut, 1);
+}
+
+static HEDLEY_ALWAYS_INLINE void gf16_muladd_multi_packpf(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	gf16_muladd_multi_packpf_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, sizeof(uint16_t), pfFactor, prefetchIn, prefetchOut, 0);
+}
+static HEDLEY_ALWAYS_INLINE void gf16_mul_multi_packpf(const void *HEDLEY_RESTRICT scratch, fMuladdPF muladd_pf, const unsigned interleave, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, size_t blockLen, const uint16_t *HEDLEY_RESTRICT coefficients, const unsigned pfFactor, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	gf16_muladd_multi_packpf_common(scratch, muladd_pf, interleave, regions, dst, src, len, blockLen, coefficients, sizeof(uint16_t), pfFactor, prefetchIn, prefetchOut, 1);
+}
+
+#endif
@@ -0,0 +1,31 @@
+
+#include "platform.h"
+
+// 256-bit variant of the AVX512 kernels: avoids the heavier frequency license that 512-bit vectors incur on some CPUs, whilst still taking advantage of AVX512VL's extra registers and ternary logic
+#define MWORD_SIZE 32
+#define _mword __m256i
+#define _MM(f) _mm256_ ## f
+#define _MMI(f) _mm256_ ## f ## _si256
+#define _FN(f) f ## _256_avx512
+#define _MM_END _mm256_zeroupper();
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+# define _AVAILABLE
+# define _AVAILABLE_AVX512VL
+#endif
+#include "gf16_shuffle_x86.h"
+
+
+#ifdef _AVAILABLE
+# undef _AVAILABLE
+#endif
+#ifdef _AVAILABLE_AVX512VL
+# undef _AVAILABLE_AVX512VL
+#endif
+
+#undef MWORD_SIZE
+#undef _mword
+#undef _MM
+#undef _MMI
+#undef _FN
+#undef _MM_END
@@ -13,10 +13,11 @@
 #endif
 #include "gf16_shuffle_x86.h"
 #include "gf16_shuffle2x_x86.h"
+#include "gf16_shuffle_nt_x86.h"
 
 
 #if defined(_AVAILABLE)
-static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_round_avx2(__m256i* _dst, const int srcCount, __m256i* _src1, __m256i* _src2, __m256i shufNormLoA, __m256i shufNormLoB, __m256i shufNormHiA, __m256i shufNormHiB, __m256i shufSwapLoA, __m256i shufSwapLoB, __m256i shufSwapHiA, __m256i shufSwapHiB) {
+static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_round_avx2(__m256i* _dst, const int doStore, const int srcCount, __m256i* _src1, __m256i* _src2, __m256i shufNormLoA, __m256i shufNormLoB, __m256i shufNormHiA, __m256i shufNormHiB, __m256i shufSwapLoA, __m256i shufSwapLoB, __m256i shufSwapHiA, __m256i shufSwapHiB) {
 	__m256i data = _mm256_load_si256(_src1);
 	__m256i mask = _mm256_set1_epi8(0x0f);
 	
@@ -28,7 +29,8 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_round_avx2(__m256i* _dst,
 	swapped = _mm256_xor_si256(_mm256_shuffle_epi8(shufSwapHiA, ti), swapped);
 	result = _mm256_xor_si256(_mm256_shuffle_epi8(shufNormHiA, ti), result);
 	
-	result = _mm256_xor_si256(result, _mm256_load_si256(_dst));
+	if(!doStore)
+		result = _mm256_xor_si256(result, _mm256_load_si256(_dst));
 	
 	if(srcCount > 1) {
 		data = _mm256_load_si256(_src2);
@@ -48,8 +50,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_round_avx2(__m256i* _dst,
 	_mm256_store_si256(_dst, result);
 }
 
-#include "gf16_muladd_multi.h"
-static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_x_avx2(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, GF16_MULADD_MULTI_SRCLIST, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf) {
+static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_x_avx2(const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf) {
 	GF16_MULADD_MULTI_SRC_UNUSED(2);
 	
 	__m256i shufNormLoA, shufSwapLoA, shufNormHiA, shufSwapHiA;
@@ -117,7 +118,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_x_avx2(const void *HEDLEY
 		intptr_t ptr = -(intptr_t)len;
 		if(len & (sizeof(__m256i)*2-1)) { // number of loop iterations isn't even, so do one iteration to make it even
 			gf16_shuffle2x_muladd_round_avx2(
-				(__m256i*)(_dst+ptr), srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
+				(__m256i*)(_dst+ptr), doStore, srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
 				shufNormLoA, shufNormLoB, shufNormHiA, shufNormHiB, shufSwapLoA, shufSwapLoB, shufSwapHiA, shufSwapHiB
 			);
 			if(doPrefetch == 1)
@@ -128,12 +129,12 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_x_avx2(const void *HEDLEY
 		}
 		while(ptr) {
 			gf16_shuffle2x_muladd_round_avx2(
-				(__m256i*)(_dst+ptr), srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
+				(__m256i*)(_dst+ptr), doStore, srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
 				shufNormLoA, shufNormLoB, shufNormHiA, shufNormHiB, shufSwapLoA, shufSwapLoB, shufSwapHiA, shufSwapHiB
 			);
 			ptr += sizeof(__m256i);
 			gf16_shuffle2x_muladd_round_avx2(
-				(__m256i*)(_dst+ptr), srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
+				(__m256i*)(_dst+ptr), doStore, srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
 				shufNormLoA, shufNormLoB, shufNormHiA, shufNormHiB, shufSwapLoA, shufSwapLoB, shufSwapHiA, shufSwapHiB
 			);
 			
@@ -146,7 +147,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle2x_muladd_x_avx2(const void *HEDLEY
 	} else {
 		for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m256i)) {
 			gf16_shuffle2x_muladd_round_avx2(
-				(__m256i*)(_dst+ptr), srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
+				(__m256i*)(_dst+ptr), doStore, srcCount, (__m256i*)(_src1+ptr*srcScale), (__m256i*)(_src2+ptr*srcScale),
 				shufNormLoA, shufNormLoB, shufNormHiA, shufNormHiB, shufSwapLoA, shufSwapLoB, shufSwapHiA, shufSwapHiB
 			);
 		}
@@ -166,6 +167,18 @@ unsigned gf16_shuffle2x_muladd_multi_avx2(const void *HEDLEY_RESTRICT scratch, u
 #endif
 }
 
+unsigned gf16_shuffle2x_mul_multi_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &gf16_shuffle2x_muladd_x_avx2, 2, regions, offset, dst, src, len, coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
 unsigned gf16_shuffle2x_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
@@ -178,6 +191,71 @@ unsigned gf16_shuffle2x_muladd_multi_packed_avx2(const void *HEDLEY_RESTRICT scr
 #endif
 }
 
+unsigned gf16_shuffle2x_mul_multi_packed_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &gf16_shuffle2x_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void gf16_shuffle2x_add_avx2(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE)
+	gf16_muladd_single(NULL, &gf16_add_x_block1_avx2, dst, src, len, 0);
+	_mm256_zeroupper();
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned gf16_shuffle2x_add_multi_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(NULL, &gf16_add_x_block1_avx2, 2, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_shuffle2x_add_multi_store_avx2(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(NULL, &gf16_add_x_block1_avx2, 2, regions, offset, dst, src, len, NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_shuffle2x_add_multi_packed_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(NULL, &gf16_add_x_block1_avx2, 2, regions, dst, src, len, sizeof(__m256i), NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned gf16_shuffle2x_add_multi_packed_store_avx2(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(NULL, &gf16_add_x_block1_avx2, 2, regions, dst, src, len, sizeof(__m256i), NULL);
+	_mm256_zeroupper();
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
 void gf16_shuffle2x_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
 	UNUSED(mutScratch);
 #if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
@@ -188,6 +266,16 @@ void gf16_shuffle2x_muladd_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch
 #endif
 }
 
+void gf16_shuffle2x_mul_multi_packpf_avx2(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &gf16_shuffle2x_muladd_x_avx2, 2, regions, dst, src, len, sizeof(__m256i), coefficients, 0, prefetchIn, prefetchOut);
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
 void gf16_shuffle2x_muladd_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, void *HEDLEY_RESTRICT mutScratch) {
 	UNUSED(mutScratch);
 #ifdef _AVAILABLE
@@ -0,0 +1,188 @@
+
+// variant of the shuffle kernels which takes data in natural byte order: the low/high byte split normally done by prepare/finish happens in registers instead
+// this costs a few shuffles per block, but avoids an extra pass over every input and output, which dominates for small jobs
+
+#ifdef _AVAILABLE
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_nt_load)(const uint8_t* src, _mword* ta, _mword* tb) {
+	_mword data1 = separate_low_high(_MMI(load)((_mword*)src));
+	_mword data2 = separate_low_high(_MMI(load)((_mword*)src + 1));
+	*ta = _MM(unpackhi_epi64)(data1, data2);
+	*tb = _MM(unpacklo_epi64)(data1, data2);
+}
+
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_nt_muladd_x)(
+	const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients,
+	const int doPrefetch, const char* _pf
+) {
+	GF16_MULADD_MULTI_SRC_UNUSED(3);
+	_mword lowA0, lowA1, lowA2, lowA3, highA0, highA1, highA2, highA3;
+	_mword lowB0, lowB1, lowB2, lowB3, highB0, highB1, highB2, highB3;
+	_mword lowC0, lowC1, lowC2, lowC3, highC0, highC1, highC2, highC3;
+
+	gf16_shuffle_setup_vec(scratch, coefficients[0], &lowA0, &highA0, &lowA1, &highA1, &lowA2, &highA2, &lowA3, &highA3);
+	if(srcCount >= 2)
+		gf16_shuffle_setup_vec(scratch, coefficients[1], &lowB0, &highB0, &lowB1, &highB1, &lowB2, &highB2, &lowB3, &highB3);
+	if(srcCount >= 3)
+		gf16_shuffle_setup_vec(scratch, coefficients[2], &lowC0, &highC0, &lowC1, &highC1, &lowC2, &highC2, &lowC3, &highC3);
+
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(_mword)*2) {
+		_mword ta, tb;
+		_mword tph = _MMI(setzero)();
+		_mword tpl = _MMI(setzero)();
+		_FN(gf16_shuffle_nt_load)(_src1+ptr*srcScale, &ta, &tb);
+		_FN(gf16_shuffle_muladd_x_vec)(ta, tb, &tpl, &tph, lowA0, highA0, lowA1, highA1, lowA2, highA2, lowA3, highA3);
+		if(srcCount >= 2) {
+			_FN(gf16_shuffle_nt_load)(_src2+ptr*srcScale, &ta, &tb);
+			_FN(gf16_shuffle_muladd_x_vec)(ta, tb, &tpl, &tph, lowB0, highB0, lowB1, highB1, lowB2, highB2, lowB3, highB3);
+		}
+		if(srcCount >= 3) {
+			_FN(gf16_shuffle_nt_load)(_src3+ptr*srcScale, &ta, &tb);
+			_FN(gf16_shuffle_muladd_x_vec)(ta, tb, &tpl, &tph, lowC0, highC0, lowC1, highC1, lowC2, highC2, lowC3, highC3);
+		}
+
+		// interleave product bytes back into words, then add to the destination as-is
+		ta = _MM(unpacklo_epi8)(tpl, tph);
+		tb = _MM(unpackhi_epi8)(tpl, tph);
+		if(!doStore) {
+			ta = _MMI(xor)(ta, _MMI(load)((_mword*)(_dst+ptr)));
+			tb = _MMI(xor)(tb, _MMI(load)((_mword*)(_dst+ptr) + 1));
+		}
+		_MMI(store) ((_mword*)(_dst+ptr), ta);
+		_MMI(store) ((_mword*)(_dst+ptr) + 1, tb);
+
+		// prefetch at half-rate, one cacheline per 128 bytes
+		if(doPrefetch && !(ptr & 127)) {
+			if(doPrefetch == 1)
+				_mm_prefetch(_pf+(ptr>>1), MM_HINT_WT1);
+			if(doPrefetch == 2)
+				_mm_prefetch(_pf+(ptr>>1), _MM_HINT_T1);
+		}
+	}
+}
+#endif
+
+
+void _FN(gf16_shuffle_nt_prepare_packed)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#ifdef _AVAILABLE
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(_mword)*2, &_FN(gf16_nt_copy_block2), &_FN(gf16_nt_copy_block2u), inputPackSize, inputNum, chunkLen,
+		GF16_SHUFFLE_MULTI_REGIONS
+	, NULL, NULL, NULL, NULL, NULL);
+	_MM_END
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+void _FN(gf16_shuffle_nt_prepare_packed_cksum)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
+#ifdef _AVAILABLE
+	_mword checksum = _MMI(setzero)();
+	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(_mword)*2, &_FN(gf16_nt_copy_block2), &_FN(gf16_nt_copy_block2u), inputPackSize, inputNum, chunkLen,
+		GF16_SHUFFLE_MULTI_REGIONS
+	, &checksum, &_FN(gf16_checksum_block), &_FN(gf16_checksum_blocku), &_FN(gf16_checksum_zeroes), &_FN(gf16_checksum_prepare));
+	_MM_END
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(srcLen); UNUSED(sliceLen); UNUSED(inputPackSize); UNUSED(inputNum); UNUSED(chunkLen);
+#endif
+}
+
+int _FN(gf16_shuffle_nt_finish_packed_cksum)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t sliceLen, unsigned numOutputs, unsigned outputNum, size_t chunkLen) {
+#ifdef _AVAILABLE
+	_mword checksum = _MMI(setzero)();
+	int ret = gf16_finish_packed(dst, src, sliceLen, sizeof(_mword)*2, &_FN(gf16_nt_copy_block2), numOutputs, outputNum, chunkLen, 1, &checksum, &_FN(gf16_checksum_block), &_FN(gf16_checksum_finish));
+	_MM_END
+	return ret;
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(sliceLen); UNUSED(numOutputs); UNUSED(outputNum); UNUSED(chunkLen);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_nt_muladd)(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#ifdef _AVAILABLE
+	gf16_muladd_single(scratch, &_FN(gf16_shuffle_nt_muladd_x), dst, src, len, val);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(val);
+#endif
+}
+
+void _FN(gf16_shuffle_nt_muladd_prefetch)(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, void *HEDLEY_RESTRICT mutScratch, const void *HEDLEY_RESTRICT prefetch) {
+	UNUSED(mutScratch);
+#ifdef _AVAILABLE
+	gf16_muladd_prefetch_single(scratch, &_FN(gf16_shuffle_nt_muladd_x), dst, src, len, val, (const char*)prefetch + len/2);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(val); UNUSED(prefetch);
+#endif
+}
+
+unsigned _FN(gf16_shuffle_nt_muladd_multi)(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_nt_muladd_multi_packed)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_nt_muladd_multi_packpf)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients, 1, prefetchIn, prefetchOut);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+unsigned _FN(gf16_shuffle_nt_mul_multi)(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_nt_mul_multi_packed)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_nt_mul_multi_packpf)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &_FN(gf16_shuffle_nt_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients, 1, prefetchIn, prefetchOut);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
@@ -12,6 +12,7 @@
 # define _AVAILABLE
 #endif
 #include "gf16_shuffle_x86.h"
+#include "gf16_shuffle_nt_x86.h"
 #undef _AVAILABLE
 
 #undef MWORD_SIZE
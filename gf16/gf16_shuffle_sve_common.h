@@ -120,7 +120,7 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle128_sve_calc_single_table(const voi
 #include "gf16_muladd_multi.h"
 static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_muladd_x)(
 	const void *HEDLEY_RESTRICT scratch,
-	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, GF16_MULADD_MULTI_SRCLIST, size_t len,
+	uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore, GF16_MULADD_MULTI_SRCLIST, size_t len,
 	const uint16_t *HEDLEY_RESTRICT coefficients, const int doPrefetch, const char* _pf
 ) {
 	GF16_MULADD_MULTI_SRC_UNUSED(3);
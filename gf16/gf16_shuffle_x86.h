@@ -10,6 +10,18 @@ int _FN(gf16_shuffle_available) = 1;
 int _FN(gf16_shuffle_available) = 0;
 #endif
 
+// number of regions the multi-region kernels process at once, which the packed layout interleaves by
+// with 16 registers, going beyond 2 regions spills too many tables to be worthwhile, whereas AVX512VL's 32 registers fit 3
+#ifdef PLATFORM_AMD64
+# ifdef _AVAILABLE_AVX512VL
+#  define GF16_SHUFFLE_MULTI_REGIONS 3
+# else
+#  define GF16_SHUFFLE_MULTI_REGIONS 2
+# endif
+#else
+# define GF16_SHUFFLE_MULTI_REGIONS 1
+#endif
+
 void _FN(gf16_shuffle_prepare)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen) {
 #ifdef _AVAILABLE
 	gf16_prepare(dst, src, srcLen, sizeof(_mword)*2, &_FN(gf16_shuffle_prepare_block), &_FN(gf16_shuffle_prepare_blocku));
@@ -22,11 +34,7 @@ void _FN(gf16_shuffle_prepare)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RES
 void _FN(gf16_shuffle_prepare_packed)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen, size_t sliceLen, unsigned inputPackSize, unsigned inputNum, size_t chunkLen) {
 #ifdef _AVAILABLE
 	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(_mword)*2, &_FN(gf16_shuffle_prepare_block), &_FN(gf16_shuffle_prepare_blocku), inputPackSize, inputNum, chunkLen,
-#if MWORD_SIZE==64 && defined(PLATFORM_AMD64)
-		3
-#else
-		1
-#endif
+		GF16_SHUFFLE_MULTI_REGIONS
 	, NULL, NULL, NULL, NULL, NULL);
 	_MM_END
 #else
@@ -38,11 +46,7 @@ void _FN(gf16_shuffle_prepare_packed_cksum)(void *HEDLEY_RESTRICT dst, const voi
 #ifdef _AVAILABLE
 	_mword checksum = _MMI(setzero)();
 	gf16_prepare_packed(dst, src, srcLen, sliceLen, sizeof(_mword)*2, &_FN(gf16_shuffle_prepare_block), &_FN(gf16_shuffle_prepare_blocku), inputPackSize, inputNum, chunkLen,
-#if MWORD_SIZE==64 && defined(PLATFORM_AMD64)
-		3
-#else
-		1
-#endif
+		GF16_SHUFFLE_MULTI_REGIONS
 	, &checksum, &_FN(gf16_checksum_block), &_FN(gf16_checksum_blocku), &_FN(gf16_checksum_zeroes), &_FN(gf16_checksum_prepare));
 	_MM_END
 #else
@@ -87,7 +91,7 @@ static HEDLEY_ALWAYS_INLINE __m256i mul16_vec256(__m128i poly, __m256i src) {
 	__m256i prodHi = _mm256_andnot_si256(_mm256_set1_epi8(0xf), src);
 	__m256i idx = _mm256_srli_epi16(prodHi, 4);
 	__m256i merge = _mm256_inserti128_si256(prodHi, _mm_shuffle_epi8(poly, _mm256_castsi256_si128(idx)), 1);
-#   if MWORD_SIZE == 64
+#   ifdef _AVAILABLE_AVX512VL
 	src = _mm256_ternarylogic_epi32(
 		extract_top128_256(idx),
 		_mm256_set1_epi8(0xf),
@@ -104,7 +108,7 @@ static HEDLEY_ALWAYS_INLINE __m256i mul16_vec256(__m128i poly, __m256i src) {
 static HEDLEY_ALWAYS_INLINE __m256i mul16_vec256(__m256i poly, __m256i src) {
 	__m256i prodHi = _mm256_and_si256(_mm256_set1_epi8(0xf), _mm256_srli_epi16(src, 4));
 	__m256i idx = _mm256_inserti128_si256(prodHi, _mm256_castsi256_si128(prodHi), 1);
-#   if MWORD_SIZE == 64
+#   ifdef _AVAILABLE_AVX512VL
 	src = _mm256_ternarylogic_epi32(
 		extract_top128_256(prodHi),
 		_mm256_set1_epi8(0xf),
@@ -186,15 +190,15 @@ static HEDLEY_ALWAYS_INLINE void gf16_shuffle_muladd_round(_mword* _dst, _mword*
 	_mword tpl = _MM(shuffle_epi8) (low0, ti);
 
 	ti = _MM_SRLI4_EPI8(tb);
-#if MWORD_SIZE == 64
-	tpl = _mm512_ternarylogic_epi32(tpl, _MM(shuffle_epi8) (low1, ti), _MMI(load)(_dst+1), 0x96);
-	tph = _mm512_ternarylogic_epi32(tph, _MM(shuffle_epi8) (high1, ti), _MMI(load)(_dst), 0x96);
+#ifdef _AVAILABLE_AVX512VL
+	tpl = _MM(ternarylogic_epi32)(tpl, _MM(shuffle_epi8) (low1, ti), _MMI(load)(_dst+1), 0x96);
+	tph = _MM(ternarylogic_epi32)(tph, _MM(shuffle_epi8) (high1, ti), _MMI(load)(_dst), 0x96);
 
 	ti = _MMI(and) (mask, ta);
 	_mword ti2 = _MMI(and) (mask, _MM(srli_epi16)(ta, 4));
 	
-	tpl = _mm512_ternarylogic_epi32(tpl, _MM(shuffle_epi8) (low2, ti), _MM(shuffle_epi8) (low3, ti2), 0x96);
-	tph = _mm512_ternarylogic_epi32(tph, _MM(shuffle_epi8) (high2, ti), _MM(shuffle_epi8) (high3, ti2), 0x96);
+	tpl = _MM(ternarylogic_epi32)(tpl, _MM(shuffle_epi8) (low2, ti), _MM(shuffle_epi8) (low3, ti2), 0x96);
+	tph = _MM(ternarylogic_epi32)(tph, _MM(shuffle_epi8) (high2, ti), _MM(shuffle_epi8) (high3, ti2), 0x96);
 #else
 	tpl = _MMI(xor)(_MM(shuffle_epi8) (low1, ti), tpl);
 	tph = _MMI(xor)(_MM(shuffle_epi8) (high1, ti), tph);
@@ -235,10 +239,10 @@ void _FN(gf16_shuffle_mul)(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RES
 		_mword tpl = _MM(shuffle_epi8) (low0, ti);
 
 		ti = _MM_SRLI4_EPI8(tb);
-#if MWORD_SIZE == 64
+#ifdef _AVAILABLE_AVX512VL
 		_mword ti2 = _MMI(and) (mask, ta);
-		tpl = _mm512_ternarylogic_epi32(tpl, _MM(shuffle_epi8) (low1, ti), _MM(shuffle_epi8) (low2, ti2), 0x96);
-		tph = _mm512_ternarylogic_epi32(tph, _MM(shuffle_epi8) (high1, ti), _MM(shuffle_epi8) (high2, ti2), 0x96);
+		tpl = _MM(ternarylogic_epi32)(tpl, _MM(shuffle_epi8) (low1, ti), _MM(shuffle_epi8) (low2, ti2), 0x96);
+		tph = _MM(ternarylogic_epi32)(tph, _MM(shuffle_epi8) (high1, ti), _MM(shuffle_epi8) (high2, ti2), 0x96);
 #else
 		tpl = _MMI(xor)(_MM(shuffle_epi8) (low1, ti), tpl);
 		tph = _MMI(xor)(_MM(shuffle_epi8) (high1, ti), tph);
@@ -312,3 +316,299 @@ void _FN(gf16_shuffle_muladd_prefetch)(const void *HEDLEY_RESTRICT scratch, void
 #endif
 }
 
+#ifdef _AVAILABLE
+// multiplies a block held in registers; the product is in the same layout as the source, so can be fed back in to compute successive powers
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_mul_vec)(_mword* ta, _mword* tb, _mword low0, _mword high0, _mword low1, _mword high1, _mword low2, _mword high2, _mword low3, _mword high3) {
+	_mword mask = _MM(set1_epi8) (0x0f);
+	_mword ti = _MMI(and) (mask, *tb);
+	_mword tph = _MM(shuffle_epi8) (high0, ti);
+	_mword tpl = _MM(shuffle_epi8) (low0, ti);
+	
+	ti = _MM_SRLI4_EPI8(*tb);
+#ifdef _AVAILABLE_AVX512VL
+	_mword ti2 = _MMI(and) (mask, *ta);
+	tpl = _MM(ternarylogic_epi32)(tpl, _MM(shuffle_epi8) (low1, ti), _MM(shuffle_epi8) (low2, ti2), 0x96);
+	tph = _MM(ternarylogic_epi32)(tph, _MM(shuffle_epi8) (high1, ti), _MM(shuffle_epi8) (high2, ti2), 0x96);
+#else
+	tpl = _MMI(xor)(_MM(shuffle_epi8) (low1, ti), tpl);
+	tph = _MMI(xor)(_MM(shuffle_epi8) (high1, ti), tph);
+	
+	ti = _MMI(and) (mask, *ta);
+	tpl = _MMI(xor)(_MM(shuffle_epi8) (low2, ti), tpl);
+	tph = _MMI(xor)(_MM(shuffle_epi8) (high2, ti), tph);
+#endif
+	ti = _MM_SRLI4_EPI8(*ta);
+	*tb = _MMI(xor)(_MM(shuffle_epi8) (low3, ti), tpl);
+	*ta = _MMI(xor)(_MM(shuffle_epi8) (high3, ti), tph);
+}
+
+// dst[n] = coefficient^(n+1) * src (or XORed into dst[n] if doAdd is set); each power is computed from the previous one, without going through memory
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_pow_x)(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, const int doAdd) {
+	_mword low0, low1, low2, low3, high0, high1, high2, high3;
+	gf16_shuffle_setup_vec(scratch, coefficient, &low0, &high0, &low1, &high1, &low2, &high2, &low3, &high3);
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	intptr_t ptr = -(intptr_t)len;
+	// the chain of multiplies is latency bound, so process two blocks at a time where possible
+	for(; ptr < -(intptr_t)sizeof(_mword)*2; ptr += sizeof(_mword)*4) {
+		_mword ta = _MMI(load)((_mword*)(_src+ptr));
+		_mword tb = _MMI(load)((_mword*)(_src+ptr) + 1);
+		_mword tc = _MMI(load)((_mword*)(_src+ptr) + 2);
+		_mword td = _MMI(load)((_mword*)(_src+ptr) + 3);
+		for(unsigned output = 0; output < outputs; output++) {
+			_FN(gf16_shuffle_mul_vec)(&ta, &tb, low0, high0, low1, high1, low2, high2, low3, high3);
+			_FN(gf16_shuffle_mul_vec)(&tc, &td, low0, high0, low1, high1, low2, high2, low3, high3);
+			_mword* _dst = (_mword*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_MMI(store) (_dst, _MMI(xor)(ta, _MMI(load)(_dst)));
+				_MMI(store) (_dst+1, _MMI(xor)(tb, _MMI(load)(_dst+1)));
+				_MMI(store) (_dst+2, _MMI(xor)(tc, _MMI(load)(_dst+2)));
+				_MMI(store) (_dst+3, _MMI(xor)(td, _MMI(load)(_dst+3)));
+			} else {
+				_MMI(store) (_dst, ta);
+				_MMI(store) (_dst+1, tb);
+				_MMI(store) (_dst+2, tc);
+				_MMI(store) (_dst+3, td);
+			}
+		}
+	}
+	if(ptr) {
+		_mword ta = _MMI(load)((_mword*)(_src+ptr));
+		_mword tb = _MMI(load)((_mword*)(_src+ptr) + 1);
+		for(unsigned output = 0; output < outputs; output++) {
+			_FN(gf16_shuffle_mul_vec)(&ta, &tb, low0, high0, low1, high1, low2, high2, low3, high3);
+			_mword* _dst = (_mword*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			if(doAdd) {
+				_MMI(store) (_dst, _MMI(xor)(ta, _MMI(load)(_dst)));
+				_MMI(store) (_dst+1, _MMI(xor)(tb, _MMI(load)(_dst+1)));
+			} else {
+				_MMI(store) (_dst, ta);
+				_MMI(store) (_dst+1, tb);
+			}
+		}
+	}
+}
+#endif
+
+void _FN(gf16_shuffle_pow)(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#ifdef _AVAILABLE
+	_FN(gf16_shuffle_pow_x)(scratch, outputs, offset, dst, src, len, coefficient, 0);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+void _FN(gf16_shuffle_pow_add)(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#ifdef _AVAILABLE
+	_FN(gf16_shuffle_pow_x)(scratch, outputs, offset, dst, src, len, coefficient, 1);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient);
+#endif
+}
+
+
+
+#ifdef _AVAILABLE
+# include "gf16_muladd_multi.h"
+#endif
+#include "gf16_add_x86.h"
+#if MWORD_SIZE < 64
+# ifdef _AVAILABLE
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_muladd_x_vec)(_mword ta, _mword tb, _mword* tpl, _mword* tph, _mword low0, _mword high0, _mword low1, _mword high1, _mword low2, _mword high2, _mword low3, _mword high3) {
+	_mword mask = _MM(set1_epi8) (0x0f);
+	_mword ti = _MMI(and) (mask, tb);
+	_mword ti2 = _MM_SRLI4_EPI8(tb);
+#ifdef _AVAILABLE_AVX512VL
+	*tpl = _MM(ternarylogic_epi32)(*tpl, _MM(shuffle_epi8) (low0, ti), _MM(shuffle_epi8) (low1, ti2), 0x96);
+	*tph = _MM(ternarylogic_epi32)(*tph, _MM(shuffle_epi8) (high0, ti), _MM(shuffle_epi8) (high1, ti2), 0x96);
+	
+	ti = _MMI(and) (mask, ta);
+	ti2 = _MM_SRLI4_EPI8(ta);
+	*tpl = _MM(ternarylogic_epi32)(*tpl, _MM(shuffle_epi8) (low2, ti), _MM(shuffle_epi8) (low3, ti2), 0x96);
+	*tph = _MM(ternarylogic_epi32)(*tph, _MM(shuffle_epi8) (high2, ti), _MM(shuffle_epi8) (high3, ti2), 0x96);
+#else
+	*tph = _MMI(xor)(_MM(shuffle_epi8) (high0, ti), *tph);
+	*tpl = _MMI(xor)(_MM(shuffle_epi8) (low0, ti), *tpl);
+	
+	*tpl = _MMI(xor)(_MM(shuffle_epi8) (low1, ti2), *tpl);
+	*tph = _MMI(xor)(_MM(shuffle_epi8) (high1, ti2), *tph);
+	
+	ti = _MMI(and) (mask, ta);
+	*tpl = _MMI(xor)(_MM(shuffle_epi8) (low2, ti), *tpl);
+	*tph = _MMI(xor)(_MM(shuffle_epi8) (high2, ti), *tph);
+	
+	ti = _MM_SRLI4_EPI8(ta);
+	*tpl = _MMI(xor)(_MM(shuffle_epi8) (low3, ti), *tpl);
+	*tph = _MMI(xor)(_MM(shuffle_epi8) (high3, ti), *tph);
+#endif
+}
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_muladd_x_round)(_mword* _src, _mword* tpl, _mword* tph, _mword low0, _mword high0, _mword low1, _mword high1, _mword low2, _mword high2, _mword low3, _mword high3) {
+	_FN(gf16_shuffle_muladd_x_vec)(_MMI(load)(_src), _MMI(load)(_src+1), tpl, tph, low0, high0, low1, high1, low2, high2, low3, high3);
+}
+
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_muladd_x)(
+	const void *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT _dst, const unsigned srcScale, const int doStore,
+	GF16_MULADD_MULTI_SRCLIST, size_t len,
+	const uint16_t *HEDLEY_RESTRICT coefficients,
+	const int doPrefetch, const char* _pf
+) {
+	GF16_MULADD_MULTI_SRC_UNUSED(3);
+	_mword lowA0, lowA1, lowA2, lowA3, highA0, highA1, highA2, highA3;
+	_mword lowB0, lowB1, lowB2, lowB3, highB0, highB1, highB2, highB3;
+	_mword lowC0, lowC1, lowC2, lowC3, highC0, highC1, highC2, highC3;
+	
+	gf16_shuffle_setup_vec(scratch, coefficients[0], &lowA0, &highA0, &lowA1, &highA1, &lowA2, &highA2, &lowA3, &highA3);
+	if(srcCount >= 2)
+		gf16_shuffle_setup_vec(scratch, coefficients[1], &lowB0, &highB0, &lowB1, &highB1, &lowB2, &highB2, &lowB3, &highB3);
+	if(srcCount >= 3)
+		gf16_shuffle_setup_vec(scratch, coefficients[2], &lowC0, &highC0, &lowC1, &highC1, &lowC2, &highC2, &lowC3, &highC3);
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(_mword)*2) {
+		_mword tph = doStore ? _MMI(setzero)() : _MMI(load)((_mword*)(_dst+ptr));
+		_mword tpl = doStore ? _MMI(setzero)() : _MMI(load)((_mword*)(_dst+ptr) + 1);
+		_FN(gf16_shuffle_muladd_x_round)((_mword*)(_src1+ptr*srcScale), &tpl, &tph, lowA0, highA0, lowA1, highA1, lowA2, highA2, lowA3, highA3);
+		if(srcCount >= 2)
+			_FN(gf16_shuffle_muladd_x_round)((_mword*)(_src2+ptr*srcScale), &tpl, &tph, lowB0, highB0, lowB1, highB1, lowB2, highB2, lowB3, highB3);
+		if(srcCount >= 3)
+			_FN(gf16_shuffle_muladd_x_round)((_mword*)(_src3+ptr*srcScale), &tpl, &tph, lowC0, highC0, lowC1, highC1, lowC2, highC2, lowC3, highC3);
+		_MMI(store) ((_mword*)(_dst+ptr), tph);
+		_MMI(store) ((_mword*)(_dst+ptr) + 1, tpl);
+		
+		// prefetch at half-rate, one cacheline per 128 bytes
+		if(doPrefetch && !(ptr & 127)) {
+			if(doPrefetch == 1)
+				_mm_prefetch(_pf+(ptr>>1), MM_HINT_WT1);
+			if(doPrefetch == 2)
+				_mm_prefetch(_pf+(ptr>>1), _MM_HINT_T1);
+		}
+	}
+}
+# endif
+
+unsigned _FN(gf16_shuffle_muladd_multi)(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_muladd_multi_packed)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_muladd_multi_packpf)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	gf16_muladd_multi_packpf(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients, 1, prefetchIn, prefetchOut);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+
+unsigned _FN(gf16_shuffle_mul_multi)(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_mul_multi_packed)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients);
+	_MM_END
+	return region;
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_add)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE)
+	gf16_muladd_single(NULL, &_FN(gf16_add_x_block2), dst, src, len, 0);
+	_MM_END
+#else
+	UNUSED(dst); UNUSED(src); UNUSED(len);
+#endif
+}
+
+unsigned _FN(gf16_shuffle_add_multi)(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi(NULL, &_FN(gf16_add_x_block2), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, NULL);
+	_MM_END
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_add_multi_store)(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi(NULL, &_FN(gf16_add_x_block2), GF16_SHUFFLE_MULTI_REGIONS, regions, offset, dst, src, len, NULL);
+	_MM_END
+	return region;
+#else
+	UNUSED(regions); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_add_multi_packed)(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_muladd_multi_packed(NULL, &_FN(gf16_add_x_block2), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, NULL);
+	_MM_END
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+unsigned _FN(gf16_shuffle_add_multi_packed_store)(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) {
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	unsigned region = gf16_mul_multi_packed(NULL, &_FN(gf16_add_x_block2), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, NULL);
+	_MM_END
+	return region;
+#else
+	UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len);
+	return 0;
+#endif
+}
+
+void _FN(gf16_shuffle_mul_multi_packpf)(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) {
+	UNUSED(mutScratch);
+#if defined(_AVAILABLE) && defined(PLATFORM_AMD64)
+	gf16_mul_multi_packpf(scratch, &_FN(gf16_shuffle_muladd_x), GF16_SHUFFLE_MULTI_REGIONS, regions, dst, src, len, sizeof(_mword)*2, coefficients, 1, prefetchIn, prefetchOut);
+	_MM_END
+#else
+	UNUSED(scratch); UNUSED(regions); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficients); UNUSED(prefetchIn); UNUSED(prefetchOut);
+#endif
+}
+#endif
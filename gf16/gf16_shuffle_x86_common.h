@@ -9,6 +9,11 @@
 # define GF16_POLYNOMIAL_SIMPLE
 #endif
 
+// AVX512VL provides ternary logic at all vector widths; 512-bit builds always have it, whilst 256-bit builds can opt in
+#if MWORD_SIZE == 64 && !defined(_AVAILABLE_AVX512VL)
+# define _AVAILABLE_AVX512VL
+#endif
+
 #define GF16_MULTBY_TWO_X2(p) ((((p) << 1) & 0xffffffff) ^ ((GF16_POLYNOMIAL ^ ((GF16_POLYNOMIAL&0xffff) << 16)) & -((p) >> 31)))
 #ifdef __SSSE3__
 static HEDLEY_ALWAYS_INLINE void initial_mul_vector(uint16_t val, __m128i* prod, __m128i* prod4) {
@@ -37,7 +42,7 @@ static HEDLEY_ALWAYS_INLINE void shuf0_vector(uint16_t val, __m128i* prod0, __m1
 	__m128i poly = _mm_and_si128(_mm_set1_epi16(GF16_POLYNOMIAL & 0xffff), _mm_cmpgt_epi16(
 		_mm_setzero_si128(), vval4
 	));
-#if MWORD_SIZE == 64
+#ifdef _AVAILABLE_AVX512VL
 	*prod8 = _mm_ternarylogic_epi32(
 		_mm_add_epi16(vval4, vval4), poly, *prod0, 0x96
 	);
@@ -95,7 +100,7 @@ static HEDLEY_ALWAYS_INLINE void mul16_vec2x(__m256i mulLo, __m256i mulHi, __m25
 #ifdef GF16_POLYNOMIAL_SIMPLE
 	srcHi = _mm256_xor_si256(srcHi, ti);
 #endif
-#if MWORD_SIZE == 64
+#ifdef _AVAILABLE_AVX512VL
 	__m256i th = _mm256_ternarylogic_epi32(
 		_mm256_srli_epi16(srcLo, 4),
 		_mm256_set1_epi8(0xf),
@@ -123,7 +128,7 @@ static HEDLEY_ALWAYS_INLINE void mul16_vec2x(__m256i mulLo, __m256i mulHi, __m25
 }
 
 static HEDLEY_ALWAYS_INLINE __m256i gf16_vec256_mul2(__m256i v) {
-# if MWORD_SIZE == 64
+# ifdef _AVAILABLE_AVX512VL
 	return _mm256_ternarylogic_epi32(
 		_mm256_add_epi16(v, v),
 		_mm256_cmpgt_epi16(_mm256_setzero_si256(), v),
@@ -153,7 +158,7 @@ static HEDLEY_ALWAYS_INLINE void mul16_vec128(__m128i mulLo, __m128i mulHi, __m1
 #ifdef GF16_POLYNOMIAL_SIMPLE
 	srcHi = _mm_xor_si128(srcHi, ti);
 #endif
-#if MWORD_SIZE == 64
+#ifdef _AVAILABLE_AVX512VL
 	__m128i th = _mm_ternarylogic_epi32(
 		_mm_srli_epi16(srcLo, 4),
 		_mm_set1_epi8(0xf),
@@ -56,3 +56,24 @@ static HEDLEY_ALWAYS_INLINE void _FN(gf16_shuffle_finish_copy_block)(void *HEDLE
 	_MMI(store)((_mword*)dst, _MM(unpacklo_epi8)(tb, ta));
 	_MMI(store)((_mword*)dst + 1, _MM(unpackhi_epi8)(tb, ta));
 }
+
+// methods working on data in natural byte order only need their inputs packed, so preparing/finishing a block is a plain copy
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_nt_copy_block)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src) {
+	_MMI(store)((_mword*)dst, _MMI(loadu)((_mword*)src));
+}
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_nt_copy_blocku)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t remaining) {
+	_MMI(store)((_mword*)dst, partial_load(src, remaining));
+}
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_nt_copy_block2)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src) {
+	_MMI(store)((_mword*)dst, _MMI(loadu)((_mword*)src));
+	_MMI(store)((_mword*)dst + 1, _MMI(loadu)((_mword*)src + 1));
+}
+static HEDLEY_ALWAYS_INLINE void _FN(gf16_nt_copy_block2u)(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t remaining) {
+	if(remaining <= sizeof(_mword)) {
+		_MMI(store)((_mword*)dst, partial_load(src, remaining));
+		_MMI(store)((_mword*)dst + 1, _MMI(setzero)());
+	} else {
+		_MMI(store)((_mword*)dst, _MMI(loadu)((_mword*)src));
+		_MMI(store)((_mword*)dst + 1, partial_load((char*)src + sizeof(_mword), remaining - sizeof(_mword)));
+	}
+}
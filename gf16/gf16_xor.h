@@ -13,6 +13,8 @@
 	void gf16_xor_jit_mul_##v(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch); \
 	void gf16_xor_jit_muladd_##v(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch); \
 	void gf16_xor_jit_muladd_prefetch_##v(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch, const void *HEDLEY_RESTRICT prefetch); \
+	void gf16_xor_jit_cache_write_##v(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient); \
+	void gf16_xor_jit_muladd_cached_##v(const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch); \
 	extern int gf16_xor_available_##v
 
 FUNCS(sse2);
@@ -21,15 +23,34 @@ FUNCS(avx512);
 
 #undef FUNCS
 
+// VEX encoded JIT; data layout is the same as SSE2, so SSE2 prepare/finish functions are used with it
+void* gf16_xor_jit_init_avx(int polynomial, int jitOptStrat);
+void* gf16_xor_jit_init_mut_avx();
+void gf16_xor_jit_mul_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
+void gf16_xor_jit_muladd_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
+void gf16_xor_jit_muladd_prefetch_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch, const void *HEDLEY_RESTRICT prefetch);
+void gf16_xor_jit_cache_write_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient);
+void gf16_xor_jit_muladd_cached_avx(const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch);
+extern int gf16_xor_available_avx;
+
 unsigned gf16_xor_jit_muladd_multi_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch);
 unsigned gf16_xor_jit_muladd_multi_packed_avx512(const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch);
 
 void gf16_xor_jit_uninit(void* scratch);
 
+// shared executable memory for code generated upfront, holding one function (for a multiply-add with prefetch) per slot
+// once written via gf16_xor_jit_cache_write_*, a slot's code can be run by any thread using gf16_xor_jit_muladd_cached_*
+#define GF16_XOR_JIT_CACHE_SLOT_SIZE 1536 // loop preamble (<256 bytes) + XORDEP_JIT_CODE_SIZE
+void* gf16_xor_jit_cache_alloc(unsigned slots);
+const void* gf16_xor_jit_cache_code(const void* cache, unsigned slot);
+void gf16_xor_jit_cache_free(void* cache);
+
 // non-JIT version
 void* gf16_xor_init_sse2(int polynomial);
 void gf16_xor_mul_sse2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
 void gf16_xor_muladd_sse2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
+void gf16_xor_pow_sse2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
+void gf16_xor_pow_add_sse2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch);
 
 
 // JIT strategies for current processor
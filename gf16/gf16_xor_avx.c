@@ -0,0 +1,443 @@
+#define _GF16_XORJIT_COPY_ALIGN 16
+#include "gf16_xor_common.h"
+#undef _GF16_XORJIT_COPY_ALIGN
+#include <string.h>
+
+/* VEX encoded version of the SSE2 XOR-JIT, for AVX CPUs without AVX2
+ * uses the same data layout as SSE2 (so prepare/finish are shared), but generated code uses 3-operand instructions, which eliminates register moves
+ * code generation follows the AVX2 version, with 128-bit vectors */
+
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+int gf16_xor_available_avx = 1;
+#else
+int gf16_xor_available_avx = 0;
+#endif
+
+
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+
+ALIGN_TO(16, __m128i xoravx_jit_clut_code1[64]);
+ALIGN_TO(16, uint8_t xoravx_jit_clut_info_mem[64]);
+ALIGN_TO(16, __m64 xoravx_jit_nums[128]);
+ALIGN_TO(16, __m64 xoravx_jit_rmask[128]);
+
+static int xoravx_jit_created = 0;
+
+static void gf16_xor_create_jit_lut_avx(void) {
+	uint_fast32_t i;
+	int j;
+	
+	if(xoravx_jit_created) return;
+	xoravx_jit_created = 1;
+	
+	memset(xoravx_jit_clut_code1, 0, sizeof(xoravx_jit_clut_code1));
+	
+	
+	for(i=0; i<64; i++) {
+		int m = (i&1) | ((i&8)>>2) | ((i&2)<<1) | ((i&16)>>1) | ((i&4)<<2) | (i&32); /* interleave bits */
+		uint_fast8_t posM = 0;
+		uint8_t* pC = (uint8_t*)(xoravx_jit_clut_code1 + i);
+		
+		for(j=0; j<3; j++) {
+			int msk = m&3;
+			
+			if(msk) {
+				int reg = msk-1;
+				
+				pC += _jit_vpxor128_m(pC, reg, reg, AX, (j-8) <<4);
+				/* advance pointers */
+				posM += 5;
+			}
+			
+			m >>= 2;
+		}
+		
+		xoravx_jit_clut_info_mem[i] = posM;
+	}
+	
+	memset(xoravx_jit_nums, 255, sizeof(xoravx_jit_nums));
+	memset(xoravx_jit_rmask, 0, sizeof(xoravx_jit_rmask));
+	for(i=0; i<128; i++) {
+		uint8_t* nums = (uint8_t*)(xoravx_jit_nums + i),
+		       * rmask = (uint8_t*)(xoravx_jit_rmask + i);
+		for(j=0; j<8; j++) {
+			if(i & (1<<j)) {
+				*nums++ = j;
+				rmask[j] = (1<<3)+1;
+			}
+		}
+	}
+}
+
+static HEDLEY_ALWAYS_INLINE __m128i ssse3_tzcnt_epi16(__m128i v) {
+	__m128i lmask = _mm_set1_epi8(0xf);
+	__m128i low = _mm_shuffle_epi8(_mm_set_epi8(
+		0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,16
+	), _mm_and_si128(v, lmask));
+	__m128i high = _mm_shuffle_epi8(_mm_set_epi8(
+		4,5,4,6,4,5,4,7,4,5,4,6,4,5,4,16
+	), _mm_and_si128(_mm_srli_epi16(v, 4), lmask));
+	__m128i combined = _mm_min_epu8(low, high);
+	low = combined;
+	high = _mm_srli_epi16(_mm_or_si128(combined, _mm_set1_epi8(8)), 8);
+	return _mm_min_epu8(low, high);
+}
+static HEDLEY_ALWAYS_INLINE __m128i ssse3_lzcnt_epi16(__m128i v) {
+	__m128i lmask = _mm_set1_epi8(0xf);
+	__m128i low = _mm_shuffle_epi8(_mm_set_epi8(
+		4,4,4,4,4,4,4,4,5,5,5,5,6,6,7,16
+	), _mm_and_si128(v, lmask));
+	__m128i high = _mm_shuffle_epi8(_mm_set_epi8(
+		0,0,0,0,0,0,0,0,1,1,1,1,2,2,3,16
+	), _mm_and_si128(_mm_srli_epi16(v, 4), lmask));
+	__m128i combined = _mm_min_epu8(low, high);
+	low = _mm_or_si128(combined, _mm_set1_epi16(8));
+	high = _mm_srli_epi16(combined, 8);
+	return _mm_min_epu8(low, high);
+}
+static HEDLEY_ALWAYS_INLINE __m128i sse4_lzcnt_to_mask_epi16(__m128i v) {
+	__m128i zeroes = _mm_cmpeq_epi16(v, _mm_setzero_si128());
+	v = _mm_blendv_epi8(
+		v,
+		_mm_slli_si128(v, 1),
+		_mm_cmplt_epi16(v, _mm_set1_epi16(8))
+	);
+	__m128i bits = _mm_shuffle_epi8(_mm_set_epi8(
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0 /* fix this case specifically */
+	), v);
+	return _mm_or_si128(bits, _mm_slli_epi16(zeroes, 15));
+}
+
+static inline uint8_t xor_write_avx_load_part(uint8_t* HEDLEY_RESTRICT* jitptr, uint8_t reg, int16_t lowest, int16_t highest) {
+	if(lowest < 16) {
+		if(lowest < 3) {
+			if(highest > 2) {
+				*jitptr += _jit_vpxor128_m(*jitptr, reg, (uint_fast8_t)highest, AX, lowest*16-128);
+			} else if(highest >= 0) {
+				*jitptr += _jit_vmovdqa128_load(*jitptr, reg, AX, highest*16-128);
+				*jitptr += _jit_vpxor128_m(*jitptr, reg, reg, AX, lowest*16-128);
+			} else
+				*jitptr += _jit_vmovdqa128_load(*jitptr, reg, AX, lowest*16-128);
+		} else {
+			if(highest >= 0) {
+				/* highest dep cannot be sourced from memory */
+				*jitptr += _jit_vpxor128_r(*jitptr, reg, (uint_fast8_t)highest, (uint_fast8_t)lowest);
+			} else
+				/* just a move */
+				*jitptr += _jit_vmovdqa128(*jitptr, reg, (uint_fast8_t)lowest);
+		}
+	}
+	return reg;
+}
+
+// table originally from http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetTable
+// modified for our use (items pre-multiplied by 4, only 128 entries)
+static const unsigned char xoravx_jit_len[128] =
+{
+#   define B2(n) n,     n+4,     n+4,     n+8
+#   define B4(n) B2(n), B2(n+4), B2(n+4), B2(n+8)
+#   define B6(n) B4(n), B4(n+4), B4(n+4), B4(n+8)
+	B6(0), B6(4)
+#undef B2
+#undef B4
+#undef B6
+};
+
+static inline int xor_write_avx_main_part(void* jitptr, uint8_t dep1, uint8_t dep2, int high) {
+	uint8_t dep = dep1 | dep2;
+	__m128i nums = _mm_loadl_epi64((__m128i*)(xoravx_jit_nums + dep));
+	// expand to 2x 4x32b + shift into place
+	__m128i srcNums = _mm_add_epi8(nums, _mm_set1_epi8(high ? 10 : 3));
+	__m128i srcs1 = _mm_slli_epi32(_mm_cvtepu8_epi32(srcNums), 11);
+	__m128i srcs2 = _mm_slli_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(srcNums, 4)), 11);
+	
+	__m128i regs = _mm_loadl_epi64((__m128i*)(xoravx_jit_rmask + dep1));
+	__m128i regs2 = _mm_loadl_epi64((__m128i*)(xoravx_jit_rmask + dep2));
+	regs = _mm_or_si128(regs, _mm_add_epi8(regs2, regs2));
+	
+	regs = _mm_shuffle_epi8(regs, nums);
+	/* VPXOR (128-bit) op-code, but last byte is 0xC0 - ((1<<3)+1) to offset the fact that our registers num is +1 too much */
+	__m128i inst1 = _mm_add_epi8(_mm_slli_epi32(_mm_cvtepu8_epi32(regs), 24), _mm_set1_epi32(0xB7EFF9C5));
+	__m128i inst2 = _mm_add_epi8(_mm_slli_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(regs, 4)), 24), _mm_set1_epi32(0xB7EFF9C5));
+	_mm_storeu_si128((__m128i*)jitptr, _mm_xor_si128(srcs1, inst1));
+	_mm_storeu_si128((__m128i*)jitptr + 1, _mm_xor_si128(srcs2, inst2));
+	
+	return xoravx_jit_len[dep];
+}
+
+static inline void* xor_write_jit_avx(const struct gf16_xor_scratch *HEDLEY_RESTRICT scratch, uint8_t *HEDLEY_RESTRICT jitptr, uint16_t val, const int xor, const int prefetch) {
+	uint_fast32_t bit;
+	
+	__m128i tmp3 = _mm_load_si128((__m128i*)(scratch->deps + ((val & 0xf) << 7)));
+	__m128i tmp4 = _mm_load_si128((__m128i*)(scratch->deps + ((val & 0xf) << 7)) +1);
+	tmp3 = _mm_xor_si128(tmp3, _mm_load_si128((__m128i*)(scratch->deps + ((val << 3) & 0x780)) + 1*2));
+	tmp4 = _mm_xor_si128(tmp4, _mm_load_si128((__m128i*)(scratch->deps + ((val << 3) & 0x780)) + 1*2 +1));
+	tmp3 = _mm_xor_si128(tmp3, _mm_load_si128((__m128i*)(scratch->deps + ((val >> 1) & 0x780)) + 2*2));
+	tmp4 = _mm_xor_si128(tmp4, _mm_load_si128((__m128i*)(scratch->deps + ((val >> 1) & 0x780)) + 2*2 +1));
+	tmp3 = _mm_xor_si128(tmp3, _mm_load_si128((__m128i*)(scratch->deps + ((val >> 5) & 0x780)) + 3*2));
+	tmp4 = _mm_xor_si128(tmp4, _mm_load_si128((__m128i*)(scratch->deps + ((val >> 5) & 0x780)) + 3*2 +1));
+	
+	
+	ALIGN_TO(16, int16_t common_highest[8]);
+	ALIGN_TO(16, int16_t common_lowest[8]);
+	ALIGN_TO(16, int16_t dep1_highest[8]);
+	ALIGN_TO(16, int16_t dep1_lowest[8]);
+	ALIGN_TO(16, int16_t dep2_highest[8]);
+	ALIGN_TO(16, int16_t dep2_lowest[8]);
+	/* obtain index of lowest bit set, and clear it */
+	__m128i common_mask = _mm_and_si128(tmp3, tmp4);
+	__m128i lowest = ssse3_tzcnt_epi16(common_mask);
+	_mm_store_si128((__m128i*)common_lowest, lowest);
+	__m128i common_sub1 = _mm_sub_epi16(common_mask, _mm_set1_epi16(1));
+	__m128i common_elim = _mm_andnot_si128(common_sub1, common_mask);
+	
+	__m128i highest;
+	common_mask = _mm_and_si128(common_mask, common_sub1);
+	
+	highest = ssse3_lzcnt_epi16(common_mask);
+	_mm_store_si128((__m128i*)common_highest, _mm_sub_epi16(_mm_set1_epi16(15), highest));
+	common_elim = _mm_or_si128(common_elim, sse4_lzcnt_to_mask_epi16(highest));
+	
+	/* clear highest/lowest bit from tmp3/4 */
+	tmp3 = _mm_xor_si128(tmp3, common_elim);
+	tmp4 = _mm_xor_si128(tmp4, common_elim);
+	
+	if(!xor) {
+		lowest = ssse3_tzcnt_epi16(tmp3);
+		_mm_store_si128((__m128i*)dep1_lowest, lowest);
+		tmp3 = _mm_and_si128(tmp3, _mm_sub_epi16(tmp3, _mm_set1_epi16(1)));
+		lowest = ssse3_tzcnt_epi16(tmp4);
+		_mm_store_si128((__m128i*)dep2_lowest, lowest);
+		tmp4 = _mm_and_si128(tmp4, _mm_sub_epi16(tmp4, _mm_set1_epi16(1)));
+	}
+	highest = ssse3_lzcnt_epi16(tmp3);
+	_mm_store_si128((__m128i*)dep1_highest, _mm_sub_epi16(_mm_set1_epi16(15), highest));
+	tmp3 = _mm_xor_si128(tmp3, sse4_lzcnt_to_mask_epi16(highest));
+	highest = ssse3_lzcnt_epi16(tmp4);
+	_mm_store_si128((__m128i*)dep2_highest, _mm_sub_epi16(_mm_set1_epi16(15), highest));
+	tmp4 = _mm_xor_si128(tmp4, sse4_lzcnt_to_mask_epi16(highest));
+	
+	
+	ALIGN_TO(16, uint16_t memDeps[8]);
+	_mm_store_si128((__m128i*)memDeps, _mm_or_si128(
+		_mm_and_si128(tmp3, _mm_set1_epi16(7)),
+		_mm_slli_epi16(_mm_and_si128(tmp4, _mm_set1_epi16(7)), 3)
+	));
+	
+	ALIGN_TO(16, uint8_t deps1[16]);
+	ALIGN_TO(16, uint8_t deps2[16]);
+	tmp3 = _mm_srli_epi16(tmp3, 3);
+	tmp4 = _mm_srli_epi16(tmp4, 3);
+	tmp3 = _mm_blendv_epi8(_mm_add_epi16(tmp3, tmp3), _mm_and_si128(tmp3, _mm_set1_epi8(0x7f)), _mm_set1_epi16(0xff));
+	tmp4 = _mm_blendv_epi8(_mm_add_epi16(tmp4, tmp4), _mm_and_si128(tmp4, _mm_set1_epi8(0x7f)), _mm_set1_epi16(0xff));
+	_mm_store_si128((__m128i*)deps1, tmp3);
+	_mm_store_si128((__m128i*)deps2, tmp4);
+	
+	
+	if(prefetch) {
+		jitptr += _jit_add_i(jitptr, SI, 128);
+		jitptr += _jit_prefetch_m(jitptr, prefetch, SI, 0);
+		jitptr += _jit_prefetch_m(jitptr, prefetch, SI, 64);
+	}
+	
+	
+	#define _ST_DQA(mreg, offs, xreg) \
+		jitptr += _jit_vmovdqa128_store(jitptr, mreg, offs, xreg)
+	#define _C_PXOR_R(rD, r2, r1, c) jitptr += _jit_vpxor128_r(jitptr, rD, r2, r1) & -(c)
+	
+	/* generate code */
+	if(xor) {
+		for(bit=0; bit<8; bit++) {
+			int destOffs = (bit<<5)-128;
+			int destOffs2 = destOffs+16;
+			uint8_t common_reg;
+			
+			/* if there's a higest bit set, do a VPXOR-load, otherwise, regular load + VPXOR-load */
+			if(dep1_highest[bit] > 2) {
+				jitptr += _jit_vpxor128_m(jitptr, 0, (uint_fast8_t)dep1_highest[bit], DX, destOffs);
+			} else {
+				jitptr += _jit_vmovdqa128_load(jitptr, 0, DX, destOffs);
+				if(dep1_highest[bit] >= 0)
+					jitptr += _jit_vpxor128_m(jitptr, 0, 0, AX, dep1_highest[bit]*16-128);
+			}
+			if(dep2_highest[bit] > 2) {
+				jitptr += _jit_vpxor128_m(jitptr, 1, (uint_fast8_t)dep2_highest[bit], DX, destOffs2);
+			} else {
+				jitptr += _jit_vmovdqa128_load(jitptr, 1, DX, destOffs2);
+				if(dep2_highest[bit] >= 0)
+					jitptr += _jit_vpxor128_m(jitptr, 1, 1, AX, dep2_highest[bit]*16-128);
+			}
+			
+			/* for common mask, if two lowest bits available, do VPXOR, else if only one, just XOR at end */
+			common_reg = xor_write_avx_load_part(&jitptr, 2, common_lowest[bit], common_highest[bit]);
+			
+			_mm_storeu_si128((__m128i*)jitptr, _mm_load_si128(&xoravx_jit_clut_code1[memDeps[bit]]));
+			jitptr += xoravx_jit_clut_info_mem[memDeps[bit]];
+			
+			jitptr += xor_write_avx_main_part(jitptr, deps1[bit*2], deps2[bit*2], 0);
+			jitptr += xor_write_avx_main_part(jitptr, deps1[bit*2+1], deps2[bit*2+1], 1);
+			
+			_C_PXOR_R(0, common_reg, 0, common_lowest[bit] < 16);
+			_C_PXOR_R(1, common_reg, 1, common_lowest[bit] < 16);
+			
+			_ST_DQA(DX, destOffs, 0);
+			_ST_DQA(DX, destOffs2, 1);
+		}
+	} else {
+		for(bit=0; bit<8; bit++) {
+			int destOffs = (bit<<5)-128;
+			int destOffs2 = destOffs+16;
+			uint8_t common_reg, reg1, reg2;
+			
+			reg1 = xor_write_avx_load_part(&jitptr, 0, dep1_lowest[bit], dep1_highest[bit]);
+			reg2 = xor_write_avx_load_part(&jitptr, 1, dep2_lowest[bit], dep2_highest[bit]);
+			common_reg = xor_write_avx_load_part(&jitptr, 2, common_lowest[bit], common_highest[bit]);
+			
+			_mm_storeu_si128((__m128i*)jitptr, _mm_load_si128(&xoravx_jit_clut_code1[memDeps[bit]]));
+			jitptr += xoravx_jit_clut_info_mem[memDeps[bit]];
+			
+			jitptr += xor_write_avx_main_part(jitptr, deps1[bit*2], deps2[bit*2], 0);
+			jitptr += xor_write_avx_main_part(jitptr, deps1[bit*2+1], deps2[bit*2+1], 1);
+			
+			if(dep1_lowest[bit] < 16) {
+				_C_PXOR_R(0, reg1, common_reg, common_lowest[bit] < 16);
+				_ST_DQA(DX, destOffs, 0);
+			} else {
+				/* dep1 must be sourced from the common mask */
+				_ST_DQA(DX, destOffs, common_reg);
+			}
+			if(dep2_lowest[bit] < 16) {
+				_C_PXOR_R(1, reg2, common_reg, common_lowest[bit] < 16);
+				_ST_DQA(DX, destOffs2, 1);
+			} else {
+				_ST_DQA(DX, destOffs2, common_reg);
+			}
+		}
+	}
+	#undef _ST_DQA
+	#undef _C_PXOR_R
+	
+	/* cmp/jcc */
+	*(uint64_t*)(jitptr) = 0x800FC03948 | (DX <<16) | (CX <<19) | ((uint64_t)JL <<32);
+	return jitptr+5;
+}
+
+static HEDLEY_ALWAYS_INLINE void gf16_xor_jit_mul_avx_base(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch, const int add, const int doPrefetch, const void *HEDLEY_RESTRICT prefetch) {
+	jit_wx_pair* jit = (jit_wx_pair*)mutScratch;
+	gf16_xorjit_write_jit(scratch, coefficient, jit, add, doPrefetch, &xor_write_jit_avx);
+	
+	gf16_xor_jit_stub(
+		(intptr_t)src - 128,
+		(intptr_t)dst + len - 128,
+		(intptr_t)dst - 128,
+		(intptr_t)prefetch - 128,
+		jit->x
+	);
+}
+#endif /* defined(__AVX__) && defined(PLATFORM_AMD64) */
+
+void gf16_xor_jit_mul_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	if(coefficient == 0) {
+		memset(dst, 0, len);
+		return;
+	}
+	gf16_xor_jit_mul_avx_base(scratch, dst, src, len, coefficient, mutScratch, 0, 0, NULL);
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient); UNUSED(mutScratch);
+#endif
+}
+
+void gf16_xor_jit_muladd_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	if(coefficient == 0) return;
+	gf16_xor_jit_mul_avx_base(scratch, dst, src, len, coefficient, mutScratch, 1, 0, NULL);
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient); UNUSED(mutScratch);
+#endif
+}
+
+void gf16_xor_jit_muladd_prefetch_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t coefficient, void *HEDLEY_RESTRICT mutScratch, const void *HEDLEY_RESTRICT prefetch) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	if(coefficient == 0) return;
+	gf16_xor_jit_mul_avx_base(scratch, dst, src, len, coefficient, mutScratch, 1, _MM_HINT_T1, prefetch);
+#else
+	UNUSED(scratch); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(coefficient); UNUSED(mutScratch); UNUSED(prefetch);
+#endif
+}
+
+
+
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+static size_t xor_write_init_jit(uint8_t *jitCode) {
+	uint8_t *jitCodeStart = jitCode;
+	jitCode += _jit_add_i(jitCode, AX, 256);
+	jitCode += _jit_add_i(jitCode, DX, 256);
+	
+	/* preload upper 13 inputs into registers */
+	for(int i=3; i<16; i++) {
+		jitCode += _jit_vmovdqa128_load(jitCode, i, AX, (i-8)<<4);
+	}
+	return jitCode-jitCodeStart;
+}
+
+# include "gf16_bitdep_init_sse2.h"
+#endif
+
+
+void* gf16_xor_jit_init_avx(int polynomial, int jitOptStrat) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	struct gf16_xor_scratch* ret;
+	uint8_t tmpCode[XORDEP_JIT_CODE_SIZE];
+	
+	ALIGN_ALLOC(ret, sizeof(struct gf16_xor_scratch), 16);
+	gf16_bitdep_init128(ret->deps, polynomial, GF16_BITDEP_INIT128_GEN_XORJIT_AVX);
+	
+	gf16_xor_create_jit_lut_avx();
+	
+	ret->jitOptStrat = jitOptStrat;
+	ret->codeStart = (uint_fast8_t)xor_write_init_jit(tmpCode);
+	return ret;
+#else
+	UNUSED(polynomial); UNUSED(jitOptStrat);
+	return NULL;
+#endif
+}
+
+void* gf16_xor_jit_init_mut_avx() {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	jit_wx_pair *jitCode = jit_alloc(XORDEP_JIT_SIZE);
+	if(!jitCode) return NULL;
+	xor_write_init_jit(jitCode->w);
+	return jitCode;
+#else
+	return NULL;
+#endif
+}
+
+void gf16_xor_jit_cache_write_avx(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	uint8_t* start = (uint8_t*)((jit_wx_pair*)cache)->w + (size_t)slot * GF16_XOR_JIT_CACHE_SLOT_SIZE;
+	uint8_t* jitptr = start + xor_write_init_jit(start);
+	jitptr = (uint8_t*)xor_write_jit_avx((const struct gf16_xor_scratch*)scratch, jitptr, coefficient, 1, _MM_HINT_T1);
+	*(int32_t*)jitptr = (int32_t)(start - jitptr -4);
+	jitptr[4] = 0xC3; /* ret */
+#else
+	UNUSED(scratch); UNUSED(cache); UNUSED(slot); UNUSED(coefficient);
+#endif
+}
+
+void gf16_xor_jit_muladd_cached_avx(const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch) {
+#if defined(__AVX__) && defined(PLATFORM_AMD64)
+	gf16_xor_jit_stub(
+		(intptr_t)src - 128,
+		(intptr_t)dst + len - 128,
+		(intptr_t)dst - 128,
+		(intptr_t)prefetch - 128,
+		(void*)code
+	);
+#else
+	UNUSED(code); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(prefetch);
+#endif
+}
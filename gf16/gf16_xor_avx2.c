@@ -720,4 +720,32 @@ void* gf16_xor_jit_init_mut_avx2() {
 #endif
 }
 
+void gf16_xor_jit_cache_write_avx2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient) {
+#if defined(__AVX2__) && defined(PLATFORM_AMD64)
+	uint8_t* start = (uint8_t*)((jit_wx_pair*)cache)->w + (size_t)slot * GF16_XOR_JIT_CACHE_SLOT_SIZE;
+	uint8_t* jitptr = start + xor_write_init_jit(start);
+	jitptr = (uint8_t*)xor_write_jit_avx((const struct gf16_xor_scratch*)scratch, jitptr, coefficient, 1, _MM_HINT_T1);
+	*(int32_t*)jitptr = (int32_t)(start - jitptr -4);
+	jitptr[4] = 0xC3; /* ret */
+	_mm256_zeroupper();
+#else
+	UNUSED(scratch); UNUSED(cache); UNUSED(slot); UNUSED(coefficient);
+#endif
+}
+
+void gf16_xor_jit_muladd_cached_avx2(const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch) {
+#if defined(__AVX2__) && defined(PLATFORM_AMD64)
+	gf16_xor256_jit_stub(
+		(intptr_t)src - 384,
+		(intptr_t)dst + len - 384,
+		(intptr_t)dst - 384,
+		(intptr_t)prefetch - 128,
+		(void*)code
+	);
+	_mm256_zeroupper();
+#else
+	UNUSED(code); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(prefetch);
+#endif
+}
+
 
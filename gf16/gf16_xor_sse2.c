@@ -942,6 +942,81 @@ void gf16_xor_muladd_sse2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_REST
 #endif
 }
 
+#ifdef __SSE2__
+static HEDLEY_ALWAYS_INLINE void gf16_xor_pow_x_sse2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, const int doAdd) {
+	uint_fast32_t counts[16];
+	ALIGN_TO(16, uintptr_t deptable[256]);
+	// a bitsliced block doesn't fit in registers, so the running product is kept in this buffer instead; the first half receives the product of the second half
+	ALIGN_TO(16, __m128i prod[32]);
+	uint8_t* p = (uint8_t*)prod;
+	
+	gf16_xor_write_deptable(deptable, counts, (uint8_t*)scratch, val, sizeof(__m128i)*16);
+	
+	uint8_t* _src = (uint8_t*)src + offset + len;
+	size_t lenPlusOffset = len + offset;
+	
+	for(intptr_t ptr = -(intptr_t)len; ptr; ptr += sizeof(__m128i)*16) {
+		memcpy(prod + 16, _src + ptr, sizeof(__m128i)*16);
+		for(unsigned output = 0; output < outputs; output++) {
+			#define STEP(bit) { \
+				uintptr_t* deps = deptable + bit*16; \
+				__m128i tmp = _mm_load_si128((__m128i*)(p + deps[ 0])); \
+				HEDLEY_ASSUME(counts[bit] <= 15); \
+				switch(counts[bit]) { \
+					case 15: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[15])); /* FALLTHRU */ \
+					case 14: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[14])); /* FALLTHRU */ \
+					case 13: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[13])); /* FALLTHRU */ \
+					case 12: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[12])); /* FALLTHRU */ \
+					case 11: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[11])); /* FALLTHRU */ \
+					case 10: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[10])); /* FALLTHRU */ \
+					case  9: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 9])); /* FALLTHRU */ \
+					case  8: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 8])); /* FALLTHRU */ \
+					case  7: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 7])); /* FALLTHRU */ \
+					case  6: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 6])); /* FALLTHRU */ \
+					case  5: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 5])); /* FALLTHRU */ \
+					case  4: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 4])); /* FALLTHRU */ \
+					case  3: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 3])); /* FALLTHRU */ \
+					case  2: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 2])); /* FALLTHRU */ \
+					case  1: tmp = _mm_xor_si128(tmp, *(__m128i*)(p + deps[ 1])); /* FALLTHRU */ \
+				} \
+				_mm_store_si128(prod + bit, tmp); \
+			}
+			STEP( 0) STEP( 1) STEP( 2) STEP( 3)
+			STEP( 4) STEP( 5) STEP( 6) STEP( 7)
+			STEP( 8) STEP( 9) STEP(10) STEP(11)
+			STEP(12) STEP(13) STEP(14) STEP(15)
+			#undef STEP
+			
+			__m128i* _dst = (__m128i*)((uint8_t*)dst[output] + lenPlusOffset + ptr);
+			for(int bit=0; bit<16; bit++) {
+				__m128i tmp = _mm_load_si128(prod + bit);
+				_mm_store_si128(prod + 16 + bit, tmp);
+				if(doAdd) tmp = _mm_xor_si128(tmp, _mm_load_si128(_dst + bit));
+				_mm_store_si128(_dst + bit, tmp);
+			}
+		}
+	}
+}
+#endif
+
+void gf16_xor_pow_sse2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#ifdef __SSE2__
+	gf16_xor_pow_x_sse2(scratch, outputs, offset, dst, src, len, val, 0);
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(val);
+#endif
+}
+
+void gf16_xor_pow_add_sse2(const void *HEDLEY_RESTRICT scratch, unsigned outputs, size_t offset, void **HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, uint16_t val, void *HEDLEY_RESTRICT mutScratch) {
+	UNUSED(mutScratch);
+#ifdef __SSE2__
+	gf16_xor_pow_x_sse2(scratch, outputs, offset, dst, src, len, val, 1);
+#else
+	UNUSED(scratch); UNUSED(outputs); UNUSED(offset); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(val);
+#endif
+}
+
 
 
 #ifdef __SSE2__
@@ -1221,6 +1296,32 @@ void* gf16_xor_jit_init_mut_sse2() {
 #endif
 }
 
+void gf16_xor_jit_cache_write_sse2(const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient) {
+#ifdef __SSE2__
+	uint8_t* start = (uint8_t*)((jit_wx_pair*)cache)->w + (size_t)slot * GF16_XOR_JIT_CACHE_SLOT_SIZE;
+	uint8_t* jitptr = start + xor_write_init_jit(start);
+	jitptr = (uint8_t*)xor_write_jit_sse((const struct gf16_xor_scratch*)scratch, jitptr, coefficient, 1, _MM_HINT_T1);
+	*(int32_t*)jitptr = (int32_t)(start - jitptr -4);
+	jitptr[4] = 0xC3; /* ret */
+#else
+	UNUSED(scratch); UNUSED(cache); UNUSED(slot); UNUSED(coefficient);
+#endif
+}
+
+void gf16_xor_jit_muladd_cached_sse2(const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch) {
+#ifdef __SSE2__
+	gf16_xor_jit_stub(
+		(intptr_t)src - 128,
+		(intptr_t)dst + len - 128,
+		(intptr_t)dst - 128,
+		(intptr_t)prefetch - 128,
+		(void*)code
+	);
+#else
+	UNUSED(code); UNUSED(dst); UNUSED(src); UNUSED(len); UNUSED(prefetch);
+#endif
+}
+
 void gf16_xor_jit_uninit(void* scratch) {
 #ifdef PLATFORM_X86
 	jit_free(scratch);
@@ -1229,6 +1330,30 @@ void gf16_xor_jit_uninit(void* scratch) {
 #endif
 }
 
+void* gf16_xor_jit_cache_alloc(unsigned slots) {
+#ifdef PLATFORM_X86
+	return jit_alloc((size_t)slots * GF16_XOR_JIT_CACHE_SLOT_SIZE);
+#else
+	UNUSED(slots);
+	return NULL;
+#endif
+}
+void gf16_xor_jit_cache_free(void* cache) {
+#ifdef PLATFORM_X86
+	jit_free(cache);
+#else
+	UNUSED(cache);
+#endif
+}
+const void* gf16_xor_jit_cache_code(const void* cache, unsigned slot) {
+#ifdef PLATFORM_X86
+	return (const uint8_t*)((const jit_wx_pair*)cache)->x + (size_t)slot * GF16_XOR_JIT_CACHE_SLOT_SIZE;
+#else
+	UNUSED(cache); UNUSED(slot);
+	return NULL;
+#endif
+}
+
 void* gf16_xor_init_sse2(int polynomial) {
 #ifdef __SSE2__
 	void* ret;
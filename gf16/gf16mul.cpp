@@ -1,6 +1,7 @@
 #include "gf16mul.h"
 #include "gf16_global.h"
 #include <cstdlib>
+#include <cstring>
 
 extern "C" {
 	#include "gf16_lookup.h"
@@ -34,12 +35,134 @@ extern "C" {
 	}
 # endif
 # include "x86_jit.h"
+#endif
+
+#include <stdio.h>
+#ifdef __linux__
+// count the number of CPUs in a list such as "0-3,8,10-11"
+static unsigned count_cpu_list(const char* list) {
+	unsigned count = 0;
+	while(*list >= '0' && *list <= '9') {
+		char* end;
+		unsigned long from = strtoul(list, &end, 10), to = from;
+		if(*end == '-')
+			to = strtoul(end+1, &end, 10);
+		if(to >= from) count += (unsigned)(to - from + 1);
+		if(*end != ',') break;
+		list = end+1;
+	}
+	return count;
+}
+static bool read_sysfs_line(const char* path, char* buf, size_t bufLen) {
+	FILE* fp = fopen(path, "r");
+	if(!fp) return false;
+	bool success = fgets(buf, (int)bufLen, fp) != NULL;
+	fclose(fp);
+	return success;
+}
+#endif
+// fallback cache detection, via the information Linux exposes in sysfs; assumes all CPUs are the same as the first
+// if sharesOnly is set, only the number of processors sharing each cache is updated, for caches which have already been detected
+static void detect_cache_sysfs(Galois16CacheInfo& cache, bool sharesOnly = false) {
+#ifdef __linux__
+	char path[80], buf[256];
+	for(int index=0; index<16; index++) {
+		sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+		if(!read_sysfs_line(path, buf, sizeof(buf))) break;
+		int level = atoi(buf);
+		sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+		if(!read_sysfs_line(path, buf, sizeof(buf)) || buf[0] == 'I') continue; // skip instruction caches
+		
+		unsigned shares = 1;
+		sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/shared_cpu_list", index);
+		if(read_sysfs_line(path, buf, sizeof(buf)))
+			shares = count_cpu_list(buf);
+		else if(sharesOnly) continue;
+		if(shares < 1) shares = 1;
+		
+		if(sharesOnly) {
+			if(level == 1 && cache.sizeL1D) cache.sharesL1D = shares;
+			else if(level == 2 && cache.sizeL2) cache.sharesL2 = shares;
+			else if(level == 3 && cache.sizeL3) cache.sharesL3 = shares;
+			continue;
+		}
+		
+		sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+		if(!read_sysfs_line(path, buf, sizeof(buf))) continue;
+		char* unit;
+		size_t size = strtoul(buf, &unit, 10);
+		if(*unit == 'K') size *= 1024;
+		else if(*unit == 'M') size *= 1024*1024;
+		
+		if(level == 1 && !cache.sizeL1D) {
+			cache.sizeL1D = size;
+			cache.sharesL1D = shares;
+		} else if(level == 2 && !cache.sizeL2) {
+			cache.sizeL2 = size;
+			cache.sharesL2 = shares;
+		} else if(level == 3 && !cache.sizeL3) {
+			cache.sizeL3 = size;
+			cache.sharesL3 = shares;
+		}
+	}
+#else
+	(void)cache;
+#endif
+}
+
+#ifdef PLATFORM_X86
+# if !defined(_WIN32)
+#  include <unistd.h>
+# endif
+// number of logical processors online, 0 if unknown
+static unsigned online_processors() {
+# ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (unsigned)info.dwNumberOfProcessors;
+# elif defined(_SC_NPROCESSORS_ONLN)
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (unsigned)count : 0;
+# else
+	return 0;
+# endif
+}
+
 struct CpuCap {
 	bool hasSSE2, hasSSSE3, hasAVX, hasAVX2, hasAVX512VLBW, hasAVX512VBMI, hasGFNI;
 	size_t propPrefShuffleThresh;
 	bool propAVX128EU, propHT;
 	bool canMemWX;
 	int jitOptStrat;
+	Galois16CacheInfo cache;
+	
+	// read deterministic cache parameters from CPUID leaf 4 (Intel) or 0x8000001D (AMD), which share the same format
+	void detectCache(int leaf) {
+		int cpuInfo[4];
+		for(int subleaf=0; subleaf<16; subleaf++) {
+			_cpuidX(cpuInfo, leaf, subleaf);
+			int type = cpuInfo[0] & 0x1f;
+			if(type == 0) break; // no more caches
+			if(type == 2) continue; // instruction cache
+			int level = (cpuInfo[0] >> 5) & 7;
+			unsigned shares = ((cpuInfo[0] >> 14) & 0xfff) + 1;
+			size_t size = (size_t)(((cpuInfo[1] >> 22) & 0x3ff) + 1) // ways
+			            * (((cpuInfo[1] >> 12) & 0x3ff) + 1) // partitions
+			            * ((cpuInfo[1] & 0xfff) + 1) // line size
+			            * ((unsigned)cpuInfo[2] + 1); // sets
+			if(level == 1) {
+				cache.sizeL1D = size;
+				cache.sharesL1D = shares;
+			} else if(level == 2) {
+				cache.sizeL2 = size;
+				cache.sharesL2 = shares;
+			} else if(level == 3) {
+				cache.sizeL3 = size;
+				cache.sharesL3 = shares;
+			}
+		}
+	}
+	
 	CpuCap(bool detect) :
 	  hasSSE2(true),
 	  hasSSSE3(true),
@@ -54,6 +177,7 @@ struct CpuCap {
 	  canMemWX(true),
 	  jitOptStrat(GF16_XOR_JIT_STRAT_NONE)
 	{
+		memset(&cache, 0, sizeof(cache));
 		if(!detect) return;
 		
 		int cpuInfo[4];
@@ -156,6 +280,32 @@ struct CpuCap {
 			}
 		}
 		
+		// detect cache topology
+		int cpuInfoMax[4];
+		_cpuid(cpuInfoMax, 0);
+		bool isIntel = (cpuInfoMax[1] == 0x756E6547 && cpuInfoMax[2] == 0x6C65746E && cpuInfoMax[3] == 0x49656E69);
+		if(isIntel && cpuInfoMax[0] >= 4)
+			detectCache(4);
+		else {
+			_cpuid(cpuInfoMax, 0x80000000);
+			if((unsigned)cpuInfoMax[0] >= 0x8000001D) {
+				_cpuid(cpuInfoMax, 0x80000001);
+				if(cpuInfoMax[2] & (1<<22)) // topology extensions
+					detectCache(0x8000001D);
+			}
+		}
+		if(!cache.sizeL1D || !cache.sizeL2)
+			detect_cache_sysfs(cache);
+		else
+			// CPUID gives the number of IDs reserved for processors sharing a cache, which is rounded up to a power of 2; sysfs lists those actually present
+			detect_cache_sysfs(cache, true);
+		unsigned processors = online_processors();
+		if(processors) {
+			if(cache.sharesL1D > processors) cache.sharesL1D = processors;
+			if(cache.sharesL2 > processors) cache.sharesL2 = processors;
+			if(cache.sharesL3 > processors) cache.sharesL3 = processors;
+		}
+		
 		// test for JIT capability
 		jit_wx_pair* jitTest = jit_alloc(256);
 		canMemWX = (jitTest != NULL);
@@ -186,8 +336,11 @@ struct CpuCap {
 	bool hasNEON;
 	bool hasSVE;
 	bool hasSVE2;
+	Galois16CacheInfo cache;
 	CpuCap(bool detect) : hasNEON(true), hasSVE(true), hasSVE2(true) {
+		memset(&cache, 0, sizeof(cache));
 		if(!detect) return;
+		detect_cache_sysfs(cache);
 		hasNEON = false;
 		hasSVE = false;
 		hasSVE2 = false;
@@ -244,14 +397,31 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 	
 	_info.idealInputMultiple = 1;
 	_info.prefetchDownscale = 0;
+	_info.expandedCoeffSize = 0;
+	_info.codeSlotSize = 0;
+	_expand_coefficients = NULL;
+	_mul_add_multi_packpf_exp = NULL;
+	_mul_multi = NULL;
+	_mul_multi_packed = NULL;
+	_mul_multi_packpf = NULL;
+	_mul_multi_packpf_exp = NULL;
+	_add = &Galois16Mul::addGeneric;
+	_add_multi = NULL;
+	_add_multi_packed = NULL;
+	_add_multi_store = NULL;
+	_add_multi_packed_store = NULL;
+	_pow = NULL;
+	_pow_add = NULL;
+	_code_write = NULL;
+	_mul_add_code = NULL;
 	switch(method) {
 		case GF16_SHUFFLE_AVX512:
+		case GF16_SHUFFLE_256_AVX512:
 		case GF16_SHUFFLE_AVX2:
 		case GF16_SHUFFLE_AVX:
 		case GF16_SHUFFLE_SSSE3:
 			_info.alignment = 16;
 			scratch = gf16_shuffle_init_x86(GF16_POLYNOMIAL);
-			// TODO: set _add
 			_info.prefetchDownscale = 1;
 			
 			switch(method) {
@@ -262,7 +432,24 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					}
 					_mul = &gf16_shuffle_mul_ssse3;
 					_mul_add = &gf16_shuffle_muladd_ssse3;
+					_add = &gf16_shuffle_add_ssse3;
 					_mul_add_pf = &gf16_shuffle_muladd_prefetch_ssse3;
+					_pow = &gf16_shuffle_pow_ssse3;
+					_pow_add = &gf16_shuffle_pow_add_ssse3;
+					#ifdef PLATFORM_AMD64
+					// only 16 registers, so tables for the second region get spilled, but that's still cheaper than reloading/storing the destination for each region
+					_mul_add_multi = &gf16_shuffle_muladd_multi_ssse3;
+					_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_ssse3;
+					_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_ssse3;
+					_mul_multi = &gf16_shuffle_mul_multi_ssse3;
+					_mul_multi_packed = &gf16_shuffle_mul_multi_packed_ssse3;
+					_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_ssse3;
+					_add_multi = &gf16_shuffle_add_multi_ssse3;
+					_add_multi_packed = &gf16_shuffle_add_multi_packed_ssse3;
+					_add_multi_store = &gf16_shuffle_add_multi_store_ssse3;
+					_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_ssse3;
+					_info.idealInputMultiple = 2;
+					#endif
 					prepare = &gf16_shuffle_prepare_ssse3;
 					prepare_packed = &gf16_shuffle_prepare_packed_ssse3;
 					prepare_packed_cksum = &gf16_shuffle_prepare_packed_cksum_ssse3;
@@ -277,7 +464,23 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					}
 					_mul = &gf16_shuffle_mul_avx;
 					_mul_add = &gf16_shuffle_muladd_avx;
+					_add = &gf16_shuffle_add_avx;
 					_mul_add_pf = &gf16_shuffle_muladd_prefetch_avx;
+					_pow = &gf16_shuffle_pow_avx;
+					_pow_add = &gf16_shuffle_pow_add_avx;
+					#ifdef PLATFORM_AMD64
+					_mul_add_multi = &gf16_shuffle_muladd_multi_avx;
+					_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_avx;
+					_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_avx;
+					_mul_multi = &gf16_shuffle_mul_multi_avx;
+					_mul_multi_packed = &gf16_shuffle_mul_multi_packed_avx;
+					_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_avx;
+					_add_multi = &gf16_shuffle_add_multi_avx;
+					_add_multi_packed = &gf16_shuffle_add_multi_packed_avx;
+					_add_multi_store = &gf16_shuffle_add_multi_store_avx;
+					_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_avx;
+					_info.idealInputMultiple = 2;
+					#endif
 					prepare = &gf16_shuffle_prepare_avx;
 					prepare_packed = &gf16_shuffle_prepare_packed_avx;
 					prepare_packed_cksum = &gf16_shuffle_prepare_packed_cksum_avx;
@@ -292,7 +495,23 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					}
 					_mul = &gf16_shuffle_mul_avx2;
 					_mul_add = &gf16_shuffle_muladd_avx2;
+					_add = &gf16_shuffle_add_avx2;
 					_mul_add_pf = &gf16_shuffle_muladd_prefetch_avx2;
+					_pow = &gf16_shuffle_pow_avx2;
+					_pow_add = &gf16_shuffle_pow_add_avx2;
+					#ifdef PLATFORM_AMD64
+					_mul_add_multi = &gf16_shuffle_muladd_multi_avx2;
+					_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_avx2;
+					_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_avx2;
+					_mul_multi = &gf16_shuffle_mul_multi_avx2;
+					_mul_multi_packed = &gf16_shuffle_mul_multi_packed_avx2;
+					_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_avx2;
+					_add_multi = &gf16_shuffle_add_multi_avx2;
+					_add_multi_packed = &gf16_shuffle_add_multi_packed_avx2;
+					_add_multi_store = &gf16_shuffle_add_multi_store_avx2;
+					_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_avx2;
+					_info.idealInputMultiple = 2;
+					#endif
 					prepare = &gf16_shuffle_prepare_avx2;
 					prepare_packed = &gf16_shuffle_prepare_packed_avx2;
 					prepare_packed_cksum = &gf16_shuffle_prepare_packed_cksum_avx2;
@@ -308,12 +527,22 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					}
 					_mul = &gf16_shuffle_mul_avx512;
 					_mul_add = &gf16_shuffle_muladd_avx512;
+					_add = &gf16_shuffle_add_avx512;
 					_mul_add_pf = &gf16_shuffle_muladd_prefetch_avx512;
+					_pow = &gf16_shuffle_pow_avx512;
+					_pow_add = &gf16_shuffle_pow_add_avx512;
 					#ifdef PLATFORM_AMD64
 					// if 32 registers are available, can do multi-region
 					_mul_add_multi = &gf16_shuffle_muladd_multi_avx512;
 					_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_avx512;
 					_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_avx512;
+					_mul_multi = &gf16_shuffle_mul_multi_avx512;
+					_mul_multi_packed = &gf16_shuffle_mul_multi_packed_avx512;
+					_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_avx512;
+					_add_multi = &gf16_shuffle_add_multi_avx512;
+					_add_multi_packed = &gf16_shuffle_add_multi_packed_avx512;
+					_add_multi_store = &gf16_shuffle_add_multi_store_avx512;
+					_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_avx512;
 					_info.idealInputMultiple = 3;
 					#endif
 					prepare = &gf16_shuffle_prepare_avx512;
@@ -324,6 +553,38 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					finish_packed_cksum = &gf16_shuffle_finish_packed_cksum_avx512;
 					_info.alignment = 64;
 				break;
+				case GF16_SHUFFLE_256_AVX512:
+					if(!gf16_shuffle_available_256_avx512 || !scratch) {
+						setupMethod(GF16_AUTO);
+						return;
+					}
+					_mul = &gf16_shuffle_mul_256_avx512;
+					_mul_add = &gf16_shuffle_muladd_256_avx512;
+					_add = &gf16_shuffle_add_256_avx512;
+					_mul_add_pf = &gf16_shuffle_muladd_prefetch_256_avx512;
+					_pow = &gf16_shuffle_pow_256_avx512;
+					_pow_add = &gf16_shuffle_pow_add_256_avx512;
+					#ifdef PLATFORM_AMD64
+					_mul_add_multi = &gf16_shuffle_muladd_multi_256_avx512;
+					_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_256_avx512;
+					_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_256_avx512;
+					_mul_multi = &gf16_shuffle_mul_multi_256_avx512;
+					_mul_multi_packed = &gf16_shuffle_mul_multi_packed_256_avx512;
+					_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_256_avx512;
+					_add_multi = &gf16_shuffle_add_multi_256_avx512;
+					_add_multi_packed = &gf16_shuffle_add_multi_packed_256_avx512;
+					_add_multi_store = &gf16_shuffle_add_multi_store_256_avx512;
+					_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_256_avx512;
+					_info.idealInputMultiple = 3;
+					#endif
+					prepare = &gf16_shuffle_prepare_256_avx512;
+					prepare_packed = &gf16_shuffle_prepare_packed_256_avx512;
+					prepare_packed_cksum = &gf16_shuffle_prepare_packed_cksum_256_avx512;
+					finish = &gf16_shuffle_finish_256_avx512;
+					finish_packed = &gf16_shuffle_finish_packed_256_avx512;
+					finish_packed_cksum = &gf16_shuffle_finish_packed_cksum_256_avx512;
+					_info.alignment = 32;
+				break;
 				default: break; // for pedantic compilers
 			}
 			_info.stride = _info.alignment*2;
@@ -336,11 +597,19 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_shuffle_mul_vbmi;
 			_mul_add = &gf16_shuffle_muladd_vbmi;
+			_add = &gf16_shuffle_add_vbmi;
 			_mul_add_pf = &gf16_shuffle_muladd_prefetch_vbmi;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_shuffle_muladd_multi_vbmi;
 			_mul_add_multi_packed = &gf16_shuffle_muladd_multi_packed_vbmi;
 			_mul_add_multi_packpf = &gf16_shuffle_muladd_multi_packpf_vbmi;
+			_mul_multi = &gf16_shuffle_mul_multi_vbmi;
+			_mul_multi_packed = &gf16_shuffle_mul_multi_packed_vbmi;
+			_mul_multi_packpf = &gf16_shuffle_mul_multi_packpf_vbmi;
+			_add_multi = &gf16_shuffle_add_multi_vbmi;
+			_add_multi_packed = &gf16_shuffle_add_multi_packed_vbmi;
+			_add_multi_store = &gf16_shuffle_add_multi_store_vbmi;
+			_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_vbmi;
 			_info.idealInputMultiple = 4;
 			_info.prefetchDownscale = 1;
 			#endif
@@ -361,10 +630,18 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_shuffle2x_mul_avx512;
 			_mul_add = &gf16_shuffle2x_muladd_avx512;
+			_add = &gf16_shuffle2x_add_avx512;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_shuffle2x_muladd_multi_avx512;
 			_mul_add_multi_packed = &gf16_shuffle2x_muladd_multi_packed_avx512;
 			_mul_add_multi_packpf = &gf16_shuffle2x_muladd_multi_packpf_avx512;
+			_mul_multi = &gf16_shuffle2x_mul_multi_avx512;
+			_mul_multi_packed = &gf16_shuffle2x_mul_multi_packed_avx512;
+			_mul_multi_packpf = &gf16_shuffle2x_mul_multi_packpf_avx512;
+			_add_multi = &gf16_shuffle2x_add_multi_avx512;
+			_add_multi_packed = &gf16_shuffle2x_add_multi_packed_avx512;
+			_add_multi_store = &gf16_shuffle2x_add_multi_store_avx512;
+			_add_multi_packed_store = &gf16_shuffle2x_add_multi_packed_store_avx512;
 			_info.idealInputMultiple = 6;
 			#endif
 			prepare = &gf16_shuffle2x_prepare_avx512;
@@ -384,10 +661,18 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_shuffle2x_mul_avx2;
 			_mul_add = &gf16_shuffle2x_muladd_avx2;
+			_add = &gf16_shuffle2x_add_avx2;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_shuffle2x_muladd_multi_avx2;
 			_mul_add_multi_packed = &gf16_shuffle2x_muladd_multi_packed_avx2;
 			_mul_add_multi_packpf = &gf16_shuffle2x_muladd_multi_packpf_avx2;
+			_mul_multi = &gf16_shuffle2x_mul_multi_avx2;
+			_mul_multi_packed = &gf16_shuffle2x_mul_multi_packed_avx2;
+			_mul_multi_packpf = &gf16_shuffle2x_mul_multi_packpf_avx2;
+			_add_multi = &gf16_shuffle2x_add_multi_avx2;
+			_add_multi_packed = &gf16_shuffle2x_add_multi_packed_avx2;
+			_add_multi_store = &gf16_shuffle2x_add_multi_store_avx2;
+			_add_multi_packed_store = &gf16_shuffle2x_add_multi_packed_store_avx2;
 			_info.idealInputMultiple = 2;
 			#endif
 			prepare = &gf16_shuffle2x_prepare_avx2;
@@ -544,11 +829,25 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_affine_mul_avx512;
 			_mul_add = &gf16_affine_muladd_avx512;
+			_add = &gf16_affine_add_avx512;
 			_mul_add_pf = &gf16_affine_muladd_prefetch_avx512;
+			_pow = &gf16_affine_pow_avx512;
+			_pow_add = &gf16_affine_pow_add_avx512;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_affine_muladd_multi_avx512;
 			_mul_add_multi_packed = &gf16_affine_muladd_multi_packed_avx512;
 			_mul_add_multi_packpf = &gf16_affine_muladd_multi_packpf_avx512;
+			_mul_multi = &gf16_affine_mul_multi_avx512;
+			_mul_multi_packed = &gf16_affine_mul_multi_packed_avx512;
+			_mul_multi_packpf = &gf16_affine_mul_multi_packpf_avx512;
+			_add_multi = &gf16_affine_add_multi_avx512;
+			_add_multi_packed = &gf16_affine_add_multi_packed_avx512;
+			_add_multi_store = &gf16_affine_add_multi_store_avx512;
+			_add_multi_packed_store = &gf16_affine_add_multi_packed_store_avx512;
+			_mul_add_multi_packpf_exp = &gf16_affine_muladd_multi_packpf_exp_avx512;
+			_mul_multi_packpf_exp = &gf16_affine_mul_multi_packpf_exp_avx512;
+			_expand_coefficients = &gf16_affine_expand_avx512;
+			_info.expandedCoeffSize = 32;
 			_info.idealInputMultiple = 6;
 			_info.prefetchDownscale = 1;
 			#endif
@@ -560,6 +859,45 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			finish_packed_cksum = &gf16_shuffle_finish_packed_cksum_avx512;
 		break;
 		
+		case GF16_AFFINE_256_AVX512:
+			scratch = gf16_affine_init_256_avx512(GF16_POLYNOMIAL);
+			_info.alignment = 32;
+			_info.stride = 64;
+			if(!gf16_affine_available_256_avx512 || !gf16_shuffle_available_256_avx512) {
+				setupMethod(GF16_AUTO);
+				return;
+			}
+			_mul = &gf16_affine_mul_256_avx512;
+			_mul_add = &gf16_affine_muladd_256_avx512;
+			_add = &gf16_affine_add_256_avx512;
+			_mul_add_pf = &gf16_affine_muladd_prefetch_256_avx512;
+			_pow = &gf16_affine_pow_256_avx512;
+			_pow_add = &gf16_affine_pow_add_256_avx512;
+			#ifdef PLATFORM_AMD64
+			_mul_add_multi = &gf16_affine_muladd_multi_256_avx512;
+			_mul_add_multi_packed = &gf16_affine_muladd_multi_packed_256_avx512;
+			_mul_add_multi_packpf = &gf16_affine_muladd_multi_packpf_256_avx512;
+			_mul_multi = &gf16_affine_mul_multi_256_avx512;
+			_mul_multi_packed = &gf16_affine_mul_multi_packed_256_avx512;
+			_mul_multi_packpf = &gf16_affine_mul_multi_packpf_256_avx512;
+			_add_multi = &gf16_affine_add_multi_256_avx512;
+			_add_multi_packed = &gf16_affine_add_multi_packed_256_avx512;
+			_add_multi_store = &gf16_affine_add_multi_store_256_avx512;
+			_add_multi_packed_store = &gf16_affine_add_multi_packed_store_256_avx512;
+			_mul_add_multi_packpf_exp = &gf16_affine_muladd_multi_packpf_exp_256_avx512;
+			_mul_multi_packpf_exp = &gf16_affine_mul_multi_packpf_exp_256_avx512;
+			_expand_coefficients = &gf16_affine_expand_256_avx512;
+			_info.expandedCoeffSize = 32;
+			_info.idealInputMultiple = 6;
+			#endif
+			prepare = &gf16_shuffle_prepare_256_avx512;
+			prepare_packed = &gf16_affine_prepare_packed_256_avx512;
+			prepare_packed_cksum = &gf16_affine_prepare_packed_cksum_256_avx512;
+			finish = &gf16_shuffle_finish_256_avx512;
+			finish_packed = &gf16_shuffle_finish_packed_256_avx512;
+			finish_packed_cksum = &gf16_shuffle_finish_packed_cksum_256_avx512;
+		break;
+		
 		case GF16_AFFINE_AVX2:
 			scratch = gf16_affine_init_avx2(GF16_POLYNOMIAL);
 			_info.alignment = 32;
@@ -570,11 +908,25 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_affine_mul_avx2;
 			_mul_add = &gf16_affine_muladd_avx2;
+			_add = &gf16_affine_add_avx2;
 			_mul_add_pf = &gf16_affine_muladd_prefetch_avx2;
+			_pow = &gf16_affine_pow_avx2;
+			_pow_add = &gf16_affine_pow_add_avx2;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_affine_muladd_multi_avx2;
 			_mul_add_multi_packed = &gf16_affine_muladd_multi_packed_avx2;
 			_mul_add_multi_packpf = &gf16_affine_muladd_multi_packpf_avx2;
+			_mul_multi = &gf16_affine_mul_multi_avx2;
+			_mul_multi_packed = &gf16_affine_mul_multi_packed_avx2;
+			_mul_multi_packpf = &gf16_affine_mul_multi_packpf_avx2;
+			_add_multi = &gf16_affine_add_multi_avx2;
+			_add_multi_packed = &gf16_affine_add_multi_packed_avx2;
+			_add_multi_store = &gf16_affine_add_multi_store_avx2;
+			_add_multi_packed_store = &gf16_affine_add_multi_packed_store_avx2;
+			_mul_add_multi_packpf_exp = &gf16_affine_muladd_multi_packpf_exp_avx2;
+			_mul_multi_packpf_exp = &gf16_affine_mul_multi_packpf_exp_avx2;
+			_expand_coefficients = &gf16_affine_expand_avx2;
+			_info.expandedCoeffSize = 32;
 			_info.idealInputMultiple = 3;
 			#endif
 			prepare = &gf16_shuffle_prepare_avx2;
@@ -595,11 +947,25 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			_mul = &gf16_affine_mul_gfni;
 			_mul_add = &gf16_affine_muladd_gfni;
+			_add = &gf16_affine_add_gfni;
 			_mul_add_pf = &gf16_affine_muladd_prefetch_gfni;
+			_pow = &gf16_affine_pow_gfni;
+			_pow_add = &gf16_affine_pow_add_gfni;
 			#ifdef PLATFORM_AMD64
 			_mul_add_multi = &gf16_affine_muladd_multi_gfni;
 			_mul_add_multi_packed = &gf16_affine_muladd_multi_packed_gfni;
 			_mul_add_multi_packpf = &gf16_affine_muladd_multi_packpf_gfni;
+			_mul_multi = &gf16_affine_mul_multi_gfni;
+			_mul_multi_packed = &gf16_affine_mul_multi_packed_gfni;
+			_mul_multi_packpf = &gf16_affine_mul_multi_packpf_gfni;
+			_add_multi = &gf16_affine_add_multi_gfni;
+			_add_multi_packed = &gf16_affine_add_multi_packed_gfni;
+			_add_multi_store = &gf16_affine_add_multi_store_gfni;
+			_add_multi_packed_store = &gf16_affine_add_multi_packed_store_gfni;
+			_mul_add_multi_packpf_exp = &gf16_affine_muladd_multi_packpf_exp_gfni;
+			_mul_multi_packpf_exp = &gf16_affine_mul_multi_packpf_exp_gfni;
+			_expand_coefficients = &gf16_affine_expand_gfni;
+			_info.expandedCoeffSize = 32;
 			_info.idealInputMultiple = 3;
 			#endif
 			prepare = &gf16_shuffle_prepare_ssse3;
@@ -619,9 +985,21 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 				return;
 			}
 			_mul_add = &gf16_affine2x_muladd_avx512;
+			_add = &gf16_affine2x_add_avx512;
 			_mul_add_multi = &gf16_affine2x_muladd_multi_avx512;
 			_mul_add_multi_packed = &gf16_affine2x_muladd_multi_packed_avx512;
 			_mul_add_multi_packpf = &gf16_affine2x_muladd_multi_packpf_avx512;
+			_mul_multi = &gf16_affine2x_mul_multi_avx512;
+			_mul_multi_packed = &gf16_affine2x_mul_multi_packed_avx512;
+			_mul_multi_packpf = &gf16_affine2x_mul_multi_packpf_avx512;
+			_add_multi = &gf16_affine2x_add_multi_avx512;
+			_add_multi_packed = &gf16_affine2x_add_multi_packed_avx512;
+			_add_multi_store = &gf16_affine2x_add_multi_store_avx512;
+			_add_multi_packed_store = &gf16_affine2x_add_multi_packed_store_avx512;
+			_mul_add_multi_packpf_exp = &gf16_affine2x_muladd_multi_packpf_exp_avx512;
+			_mul_multi_packpf_exp = &gf16_affine2x_mul_multi_packpf_exp_avx512;
+			_expand_coefficients = &gf16_affine_expand_avx512;
+			_info.expandedCoeffSize = 32;
 			#ifdef PLATFORM_AMD64
 			_info.idealInputMultiple = 12;
 			#else
@@ -644,9 +1022,21 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 				return;
 			}
 			_mul_add = &gf16_affine2x_muladd_avx2;
+			_add = &gf16_affine2x_add_avx2;
 			_mul_add_multi = &gf16_affine2x_muladd_multi_avx2;
 			_mul_add_multi_packed = &gf16_affine2x_muladd_multi_packed_avx2;
 			_mul_add_multi_packpf = &gf16_affine2x_muladd_multi_packpf_avx2;
+			_mul_multi = &gf16_affine2x_mul_multi_avx2;
+			_mul_multi_packed = &gf16_affine2x_mul_multi_packed_avx2;
+			_mul_multi_packpf = &gf16_affine2x_mul_multi_packpf_avx2;
+			_add_multi = &gf16_affine2x_add_multi_avx2;
+			_add_multi_packed = &gf16_affine2x_add_multi_packed_avx2;
+			_add_multi_store = &gf16_affine2x_add_multi_store_avx2;
+			_add_multi_packed_store = &gf16_affine2x_add_multi_packed_store_avx2;
+			_mul_add_multi_packpf_exp = &gf16_affine2x_muladd_multi_packpf_exp_avx2;
+			_mul_multi_packpf_exp = &gf16_affine2x_mul_multi_packpf_exp_avx2;
+			_expand_coefficients = &gf16_affine_expand_avx2;
+			_info.expandedCoeffSize = 32;
 			#ifdef PLATFORM_AMD64
 			_info.idealInputMultiple = 6;
 			#else
@@ -669,9 +1059,21 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 				return;
 			}
 			_mul_add = &gf16_affine2x_muladd_gfni;
+			_add = &gf16_affine2x_add_gfni;
 			_mul_add_multi = &gf16_affine2x_muladd_multi_gfni;
 			_mul_add_multi_packed = &gf16_affine2x_muladd_multi_packed_gfni;
 			_mul_add_multi_packpf = &gf16_affine2x_muladd_multi_packpf_gfni;
+			_mul_multi = &gf16_affine2x_mul_multi_gfni;
+			_mul_multi_packed = &gf16_affine2x_mul_multi_packed_gfni;
+			_mul_multi_packpf = &gf16_affine2x_mul_multi_packpf_gfni;
+			_add_multi = &gf16_affine2x_add_multi_gfni;
+			_add_multi_packed = &gf16_affine2x_add_multi_packed_gfni;
+			_add_multi_store = &gf16_affine2x_add_multi_store_gfni;
+			_add_multi_packed_store = &gf16_affine2x_add_multi_packed_store_gfni;
+			_mul_add_multi_packpf_exp = &gf16_affine2x_muladd_multi_packpf_exp_gfni;
+			_mul_multi_packpf_exp = &gf16_affine2x_mul_multi_packpf_exp_gfni;
+			_expand_coefficients = &gf16_affine_expand_gfni;
+			_info.expandedCoeffSize = 32;
 			#ifdef PLATFORM_AMD64
 			_info.idealInputMultiple = 6;
 			#else
@@ -684,15 +1086,142 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			finish_packed = &gf16_affine2x_finish_packed_gfni;
 			finish_packed_cksum = &gf16_affine2x_finish_packed_cksum_gfni;
 		break;
-		
+
+		// variants of the above operating on data in natural byte order, which only need prepare/finish to (un)interleave
+		case GF16_SHUFFLE_NT_AVX2:
+		case GF16_SHUFFLE_NT_SSSE3:
+			scratch = gf16_shuffle_init_x86(GF16_POLYNOMIAL);
+			_info.prefetchDownscale = 1;
+			if(method == GF16_SHUFFLE_NT_AVX2) {
+				if(!gf16_shuffle_available_avx2 || !scratch) {
+					setupMethod(GF16_AUTO);
+					return;
+				}
+				_mul_add = &gf16_shuffle_nt_muladd_avx2;
+				_add = &gf16_shuffle_add_avx2;
+				_mul_add_pf = &gf16_shuffle_nt_muladd_prefetch_avx2;
+				#ifdef PLATFORM_AMD64
+				_mul_add_multi = &gf16_shuffle_nt_muladd_multi_avx2;
+				_mul_add_multi_packed = &gf16_shuffle_nt_muladd_multi_packed_avx2;
+				_mul_add_multi_packpf = &gf16_shuffle_nt_muladd_multi_packpf_avx2;
+				_mul_multi = &gf16_shuffle_nt_mul_multi_avx2;
+				_mul_multi_packed = &gf16_shuffle_nt_mul_multi_packed_avx2;
+				_mul_multi_packpf = &gf16_shuffle_nt_mul_multi_packpf_avx2;
+				_add_multi = &gf16_shuffle_add_multi_avx2;
+				_add_multi_packed = &gf16_shuffle_add_multi_packed_avx2;
+				_add_multi_store = &gf16_shuffle_add_multi_store_avx2;
+				_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_avx2;
+				_info.idealInputMultiple = 2;
+				#endif
+				prepare_packed = &gf16_shuffle_nt_prepare_packed_avx2;
+				prepare_packed_cksum = &gf16_shuffle_nt_prepare_packed_cksum_avx2;
+				finish_packed_cksum = &gf16_shuffle_nt_finish_packed_cksum_avx2;
+				_info.alignment = 32;
+			} else {
+				if(!gf16_shuffle_available_ssse3 || !scratch) {
+					setupMethod(GF16_AUTO);
+					return;
+				}
+				_mul_add = &gf16_shuffle_nt_muladd_ssse3;
+				_add = &gf16_shuffle_add_ssse3;
+				_mul_add_pf = &gf16_shuffle_nt_muladd_prefetch_ssse3;
+				#ifdef PLATFORM_AMD64
+				_mul_add_multi = &gf16_shuffle_nt_muladd_multi_ssse3;
+				_mul_add_multi_packed = &gf16_shuffle_nt_muladd_multi_packed_ssse3;
+				_mul_add_multi_packpf = &gf16_shuffle_nt_muladd_multi_packpf_ssse3;
+				_mul_multi = &gf16_shuffle_nt_mul_multi_ssse3;
+				_mul_multi_packed = &gf16_shuffle_nt_mul_multi_packed_ssse3;
+				_mul_multi_packpf = &gf16_shuffle_nt_mul_multi_packpf_ssse3;
+				_add_multi = &gf16_shuffle_add_multi_ssse3;
+				_add_multi_packed = &gf16_shuffle_add_multi_packed_ssse3;
+				_add_multi_store = &gf16_shuffle_add_multi_store_ssse3;
+				_add_multi_packed_store = &gf16_shuffle_add_multi_packed_store_ssse3;
+				_info.idealInputMultiple = 2;
+				#endif
+				prepare_packed = &gf16_shuffle_nt_prepare_packed_ssse3;
+				prepare_packed_cksum = &gf16_shuffle_nt_prepare_packed_cksum_ssse3;
+				finish_packed_cksum = &gf16_shuffle_nt_finish_packed_cksum_ssse3;
+				_info.alignment = 16;
+			}
+			_info.stride = _info.alignment*2;
+		break;
+
+		case GF16_AFFINE_NT_AVX2:
+			scratch = gf16_affine_init_avx2(GF16_POLYNOMIAL);
+			_info.alignment = 32;
+			_info.stride = 32;
+			if(!gf16_affine_available_avx2 || !gf16_shuffle_available_avx2) {
+				setupMethod(GF16_AUTO);
+				return;
+			}
+			_mul_add = &gf16_affine_nt_muladd_avx2;
+			_add = &gf16_affine2x_add_avx2;
+			_mul_add_multi = &gf16_affine_nt_muladd_multi_avx2;
+			_mul_add_multi_packed = &gf16_affine_nt_muladd_multi_packed_avx2;
+			_mul_add_multi_packpf = &gf16_affine_nt_muladd_multi_packpf_avx2;
+			_mul_multi = &gf16_affine_nt_mul_multi_avx2;
+			_mul_multi_packed = &gf16_affine_nt_mul_multi_packed_avx2;
+			_mul_multi_packpf = &gf16_affine_nt_mul_multi_packpf_avx2;
+			_add_multi = &gf16_affine2x_add_multi_avx2;
+			_add_multi_packed = &gf16_affine2x_add_multi_packed_avx2;
+			_add_multi_store = &gf16_affine2x_add_multi_store_avx2;
+			_add_multi_packed_store = &gf16_affine2x_add_multi_packed_store_avx2;
+			_mul_add_multi_packpf_exp = &gf16_affine_nt_muladd_multi_packpf_exp_avx2;
+			_mul_multi_packpf_exp = &gf16_affine_nt_mul_multi_packpf_exp_avx2;
+			_expand_coefficients = &gf16_affine_expand_avx2;
+			_info.expandedCoeffSize = 32;
+			#ifdef PLATFORM_AMD64
+			_info.idealInputMultiple = 6;
+			#else
+			_info.idealInputMultiple = 2;
+			#endif
+			prepare_packed = &gf16_affine_nt_prepare_packed_avx2;
+			prepare_packed_cksum = &gf16_affine_nt_prepare_packed_cksum_avx2;
+			finish_packed_cksum = &gf16_affine_nt_finish_packed_cksum_avx2;
+		break;
+
+		case GF16_AFFINE_NT_GFNI:
+			scratch = gf16_affine_init_gfni(GF16_POLYNOMIAL);
+			_info.alignment = 16;
+			_info.stride = 16;
+			if(!gf16_affine_available_gfni || !gf16_shuffle_available_ssse3) {
+				setupMethod(GF16_AUTO);
+				return;
+			}
+			_mul_add = &gf16_affine_nt_muladd_gfni;
+			_add = &gf16_affine2x_add_gfni;
+			_mul_add_multi = &gf16_affine_nt_muladd_multi_gfni;
+			_mul_add_multi_packed = &gf16_affine_nt_muladd_multi_packed_gfni;
+			_mul_add_multi_packpf = &gf16_affine_nt_muladd_multi_packpf_gfni;
+			_mul_multi = &gf16_affine_nt_mul_multi_gfni;
+			_mul_multi_packed = &gf16_affine_nt_mul_multi_packed_gfni;
+			_mul_multi_packpf = &gf16_affine_nt_mul_multi_packpf_gfni;
+			_add_multi = &gf16_affine2x_add_multi_gfni;
+			_add_multi_packed = &gf16_affine2x_add_multi_packed_gfni;
+			_add_multi_store = &gf16_affine2x_add_multi_store_gfni;
+			_add_multi_packed_store = &gf16_affine2x_add_multi_packed_store_gfni;
+			_mul_add_multi_packpf_exp = &gf16_affine_nt_muladd_multi_packpf_exp_gfni;
+			_mul_multi_packpf_exp = &gf16_affine_nt_mul_multi_packpf_exp_gfni;
+			_expand_coefficients = &gf16_affine_expand_gfni;
+			_info.expandedCoeffSize = 32;
+			#ifdef PLATFORM_AMD64
+			_info.idealInputMultiple = 6;
+			#else
+			_info.idealInputMultiple = 2;
+			#endif
+			prepare_packed = &gf16_affine_nt_prepare_packed_gfni;
+			prepare_packed_cksum = &gf16_affine_nt_prepare_packed_cksum_gfni;
+			finish_packed_cksum = &gf16_affine_nt_finish_packed_cksum_gfni;
+		break;
+
 		case GF16_XOR_JIT_AVX512:
 		case GF16_XOR_JIT_AVX2:
-		//case GF16_XOR_JIT_AVX:
+		case GF16_XOR_JIT_AVX:
 		case GF16_XOR_JIT_SSE2:
 		case GF16_XOR_SSE2: {
 #ifdef PLATFORM_X86
 			_info.alignment = 16;
-			int jitOptStrat = CpuCap(true).jitOptStrat;
+			int jitOptStrat = _jitOptStrat >= 0 ? _jitOptStrat : CpuCap(true).jitOptStrat;
 			_info.prefetchDownscale = 1;
 			
 			switch(method) {
@@ -706,11 +1235,15 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 						scratch = gf16_xor_init_sse2(GF16_POLYNOMIAL);
 						_mul = &gf16_xor_mul_sse2;
 						_mul_add = &gf16_xor_muladd_sse2;
+						_pow = &gf16_xor_pow_sse2;
+						_pow_add = &gf16_xor_pow_add_sse2;
 					} else {
 						scratch = gf16_xor_jit_init_sse2(GF16_POLYNOMIAL, jitOptStrat);
 						_mul = &gf16_xor_jit_mul_sse2;
 						_mul_add = &gf16_xor_jit_muladd_sse2;
 						_mul_add_pf = &gf16_xor_jit_muladd_prefetch_sse2;
+						_code_write = &gf16_xor_jit_cache_write_sse2;
+						_mul_add_code = &gf16_xor_jit_muladd_cached_sse2;
 					}
 					prepare = &gf16_xor_prepare_sse2;
 					prepare_packed = &gf16_xor_prepare_packed_sse2;
@@ -719,24 +1252,25 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					finish_packed = &gf16_xor_finish_packed_sse2;
 					finish_packed_cksum = &gf16_xor_finish_packed_cksum_sse2;
 				break;
-				/*
 				case GF16_XOR_JIT_AVX:
 					if(!gf16_xor_available_avx) {
 						setupMethod(GF16_AUTO);
 						return;
 					}
-					scratch = gf16_xor_jit_init_sse2(GF16_POLYNOMIAL, jitOptStrat);
+					scratch = gf16_xor_jit_init_avx(GF16_POLYNOMIAL, jitOptStrat);
 					_mul = &gf16_xor_jit_mul_avx;
 					_mul_add = &gf16_xor_jit_muladd_avx;
 					_mul_add_pf = &gf16_xor_jit_muladd_prefetch_avx;
-					prepare = &gf16_xor_prepare_avx;
-					prepare_packed = &gf16_xor_prepare_packed_avx;
-					prepare_packed_cksum = &gf16_xor_prepare_packed_cksum_avx;
-					finish = &gf16_xor_finish_avx;
-					finish_packed = &gf16_xor_finish_packed_avx;
-					finish_packed_cksum = &gf16_xor_finish_packed_cksum_avx;
+					_code_write = &gf16_xor_jit_cache_write_avx;
+					_mul_add_code = &gf16_xor_jit_muladd_cached_avx;
+					// same data layout as SSE2
+					prepare = &gf16_xor_prepare_sse2;
+					prepare_packed = &gf16_xor_prepare_packed_sse2;
+					prepare_packed_cksum = &gf16_xor_prepare_packed_cksum_sse2;
+					finish = &gf16_xor_finish_sse2;
+					finish_packed = &gf16_xor_finish_packed_sse2;
+					finish_packed_cksum = &gf16_xor_finish_packed_cksum_sse2;
 				break;
-				*/
 				case GF16_XOR_JIT_AVX2:
 					if(!gf16_xor_available_avx2) {
 						setupMethod(GF16_AUTO);
@@ -746,6 +1280,8 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 					_mul = &gf16_xor_jit_mul_avx2;
 					_mul_add = &gf16_xor_jit_muladd_avx2;
 					_mul_add_pf = &gf16_xor_jit_muladd_prefetch_avx2;
+					_code_write = &gf16_xor_jit_cache_write_avx2;
+					_mul_add_code = &gf16_xor_jit_muladd_cached_avx2;
 					prepare = &gf16_xor_prepare_avx2;
 					prepare_packed = &gf16_xor_prepare_packed_avx2;
 					prepare_packed_cksum = &gf16_xor_prepare_packed_cksum_avx2;
@@ -778,6 +1314,11 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 			}
 			
 			_info.stride = _info.alignment*16;
+			if(_code_write) {
+				// code for each coefficient can be cached, with pointers to it used as expanded coefficients
+				_info.expandedCoeffSize = sizeof(void*);
+				_info.codeSlotSize = GF16_XOR_JIT_CACHE_SLOT_SIZE;
+			}
 #else
 			setupMethod(GF16_AUTO);
 			return;
@@ -819,28 +1360,35 @@ void Galois16Mul::setupMethod(Galois16Methods method) {
 	_info.id = method;
 	_info.name = Galois16MethodsText[(int)method];
 	
+	// size chunks relative to the per-core cache sizes; if these can't be detected, assume 32KB L1D and 256KB L2
 	// TODO: improve these?
-	// TODO: this probably needs to be variable depending on the CPU cache size
-	// although these defaults are pretty good across most CPUs
+	const Galois16CacheInfo& cache = cacheInfo();
+	size_t sizeL1D = cache.sizeL1D ? cache.sizeL1D : 32*1024;
+	size_t sizeL2 = cache.sizeL2 ? cache.sizeL2 : 256*1024;
 	switch(method) {
 		case GF16_XOR_JIT_SSE2: // JIT is a little slow, so larger blocks make things faster
+		case GF16_XOR_JIT_AVX:
 		case GF16_XOR_JIT_AVX2:
 		case GF16_XOR_JIT_AVX512:
-			_info.idealChunkSize = 128*1024; // half L2 cache?
+			_info.idealChunkSize = sizeL2 / 2;
 		break;
 		case GF16_LOOKUP:
 		case GF16_LOOKUP_SSE2:
 		case GF16_LOOKUP3:
 		case GF16_XOR_SSE2:
-			_info.idealChunkSize = 96*1024; // 2* L1 data cache size ?
+			_info.idealChunkSize = sizeL1D * 2;
 		break;
 		default: // Shuffle/Affine
-			_info.idealChunkSize = 48*1024; // ~=L1 * 1-2 data cache size seems to be efficient
+			_info.idealChunkSize = sizeL1D + sizeL1D/2; // ~=L1 * 1-2 data cache size seems to be efficient
 	}
+	// guard against odd values reported by the CPU/VM
+	if(_info.idealChunkSize < 16*1024) _info.idealChunkSize = 16*1024;
+	if(_info.idealChunkSize > 512*1024) _info.idealChunkSize = 512*1024;
 }
 
-Galois16Mul::Galois16Mul(Galois16Methods method) {
+Galois16Mul::Galois16Mul(Galois16Methods method, int jitOptStrat) {
 	scratch = NULL;
+	_jitOptStrat = jitOptStrat;
 	prepare = &Galois16Mul::_prepare_none;
 	prepare_packed = &Galois16Mul::_prepare_packed_none;
 	finish = &Galois16Mul::_finish_none;
@@ -851,9 +1399,23 @@ Galois16Mul::Galois16Mul(Galois16Methods method) {
 	_mul = NULL;
 	_mul_add_pf = NULL;
 	_add = &Galois16Mul::addGeneric;
+	_add_multi = NULL;
+	_add_multi_packed = NULL;
+	_add_multi_store = NULL;
+	_add_multi_packed_store = NULL;
 	_mul_add_multi = &Galois16Mul::_mul_add_multi_none;
 	_mul_add_multi_packed = NULL;
 	_mul_add_multi_packpf = NULL;
+	_mul_add_multi_packpf_exp = NULL;
+	_mul_multi = NULL;
+	_mul_multi_packed = NULL;
+	_mul_multi_packpf = NULL;
+	_mul_multi_packpf_exp = NULL;
+	_expand_coefficients = NULL;
+	_info.expandedCoeffSize = 0;
+	_info.codeSlotSize = 0;
+	_code_write = NULL;
+	_mul_add_code = NULL;
 	
 	_pow = NULL;
 	_pow_add = NULL;
@@ -878,6 +1440,7 @@ void Galois16Mul::move(Galois16Mul& other) {
 	finish_packed = other.finish_packed;
 	finish_packed_cksum = other.finish_packed_cksum;
 	_info = other._info;
+	_jitOptStrat = other._jitOptStrat;
 	_mul = other._mul;
 	_add = other._add;
 	_mul_add = other._mul_add;
@@ -885,6 +1448,18 @@ void Galois16Mul::move(Galois16Mul& other) {
 	_mul_add_multi = other._mul_add_multi;
 	_mul_add_multi_packed = other._mul_add_multi_packed;
 	_mul_add_multi_packpf = other._mul_add_multi_packpf;
+	_mul_add_multi_packpf_exp = other._mul_add_multi_packpf_exp;
+	_mul_multi = other._mul_multi;
+	_mul_multi_packed = other._mul_multi_packed;
+	_mul_multi_packpf = other._mul_multi_packpf;
+	_mul_multi_packpf_exp = other._mul_multi_packpf_exp;
+	_add_multi = other._add_multi;
+	_add_multi_packed = other._add_multi_packed;
+	_add_multi_store = other._add_multi_store;
+	_add_multi_packed_store = other._add_multi_packed_store;
+	_expand_coefficients = other._expand_coefficients;
+	_code_write = other._code_write;
+	_mul_add_code = other._mul_add_code;
 	_pow = other._pow;
 	_pow_add = other._pow_add;
 }
@@ -895,6 +1470,8 @@ void* Galois16Mul::mutScratch_alloc() const {
 	switch(_info.id) {
 		case GF16_XOR_JIT_SSE2:
 			return gf16_xor_jit_init_mut_sse2();
+		case GF16_XOR_JIT_AVX:
+			return gf16_xor_jit_init_mut_avx();
 		case GF16_XOR_JIT_AVX2:
 			return gf16_xor_jit_init_mut_avx2();
 		case GF16_XOR_JIT_AVX512:
@@ -904,9 +1481,20 @@ void* Galois16Mul::mutScratch_alloc() const {
 			return NULL;
 	}
 }
+void* Galois16Mul::codeCache_alloc(unsigned slots) const {
+	if(!hasCodeCache()) return NULL;
+	return gf16_xor_jit_cache_alloc(slots);
+}
+void Galois16Mul::codeCache_free(void* cache) const {
+	gf16_xor_jit_cache_free(cache);
+}
+const void* Galois16Mul::codeCache_code(const void* cache, unsigned slot) const {
+	return gf16_xor_jit_cache_code(cache, slot);
+}
 void Galois16Mul::mutScratch_free(void* mutScratch) const {
 	switch(_info.id) {
 		case GF16_XOR_JIT_SSE2:
+		case GF16_XOR_JIT_AVX:
 		case GF16_XOR_JIT_AVX2:
 		case GF16_XOR_JIT_AVX512:
 			gf16_xor_jit_uninit(mutScratch);
@@ -915,11 +1503,29 @@ void Galois16Mul::mutScratch_free(void* mutScratch) const {
 	}
 }
 
-Galois16Methods Galois16Mul::default_method(size_t regionSizeHint, unsigned /*outputs*/, unsigned /*threadCountHint*/) {
+Galois16Methods Galois16Mul::default_method(size_t regionSizeHint, unsigned /*outputs*/, unsigned threadCountHint) {
 	const CpuCap caps(true);
 	
 #ifdef PLATFORM_X86
+	// if GF isn't given all cores, other work runs alongside it, which 512-bit vectors would slow down via the frequency license they trigger
+	// the number of processors sharing the L3 (limited to those present) is used as an approximation of the number of cores available
+	bool sharesCores = threadCountHint && caps.cache.sharesL3 && threadCountHint < caps.cache.sharesL3;
+	// for tiny slices, the extra passes to transform inputs/outputs cost more than splitting bytes in-register
+	if(regionSizeHint && regionSizeHint <= 1024) {
+		if(caps.hasGFNI && gf16_affine_available_avx2 && gf16_shuffle_available_avx2 && caps.hasAVX2)
+			return GF16_AFFINE_NT_AVX2;
+		if(caps.hasGFNI && gf16_affine_available_gfni && gf16_shuffle_available_ssse3 && caps.hasSSSE3)
+			return GF16_AFFINE_NT_GFNI;
+		if(!caps.hasAVX512VLBW) {
+			if(gf16_shuffle_available_avx2 && caps.hasAVX2)
+				return GF16_SHUFFLE_NT_AVX2;
+			if(gf16_shuffle_available_ssse3 && caps.hasSSSE3 && !caps.hasAVX)
+				return GF16_SHUFFLE_NT_SSSE3;
+		}
+	}
 	if(caps.hasGFNI) {
+		if(gf16_affine_available_256_avx512 && gf16_shuffle_available_256_avx512 && caps.hasAVX512VLBW && sharesCores)
+			return GF16_AFFINE_256_AVX512;
 		if(gf16_affine_available_avx512 && caps.hasAVX512VLBW)
 			return GF16_AFFINE2X_AVX512; // better peak at 24x1KB, whereas 1x is better at 18x1KB
 		if(gf16_affine_available_avx2 && caps.hasAVX2)
@@ -928,6 +1534,8 @@ Galois16Methods Galois16Mul::default_method(size_t regionSizeHint, unsigned /*ou
 	if(caps.hasAVX512VLBW) {
 		if(gf16_shuffle_available_vbmi && caps.hasAVX512VBMI)
 			return GF16_SHUFFLE_VBMI;
+		if(gf16_shuffle_available_256_avx512 && sharesCores)
+			return GF16_SHUFFLE_256_AVX512;
 		if(gf16_shuffle_available_avx512)
 			return GF16_SHUFFLE_AVX512;
 	}
@@ -949,8 +1557,9 @@ Galois16Methods Galois16Mul::default_method(size_t regionSizeHint, unsigned /*ou
 		return GF16_AFFINE_GFNI; // presumably this beats XOR-JIT
 	if(!regionSizeHint || regionSizeHint > caps.propPrefShuffleThresh) {
 		// TODO: if only a few recovery slices being made (e.g. 3), prefer shuffle
-		//if(gf16_xor_available_avx && caps.hasAVX && caps.canMemWX)
-		//	return GF16_XOR_JIT_AVX;
+		// xorjit-avx has only been measured on CPUs with full width AVX units, so others stay on the SSE2 JIT
+		if(gf16_xor_available_avx && caps.hasAVX && !caps.propAVX128EU && caps.canMemWX)
+			return GF16_XOR_JIT_AVX;
 		if(gf16_xor_available_sse2 && caps.hasSSE2 && caps.canMemWX)
 			return GF16_XOR_JIT_SSE2;
 	}
@@ -977,6 +1586,77 @@ Galois16Methods Galois16Mul::default_method(size_t regionSizeHint, unsigned /*ou
 	return GF16_LOOKUP;
 }
 
+const Galois16CacheInfo& Galois16Mul::cacheInfo() {
+	// detection is somewhat expensive (particularly the sysfs fallback), so only do it once
+	static const Galois16CacheInfo cache = CpuCap(true).cache;
+	return cache;
+}
+
+// identifies the CPU model, so that tuning results can be associated with it
+const char* Galois16Mul::cpuSignature() {
+	static char signature[128] = {0};
+	if(signature[0]) return signature;
+#ifdef PLATFORM_X86
+	int cpuInfo[4];
+	char vendor[13];
+	_cpuid(cpuInfo, 0);
+	memcpy(vendor, cpuInfo+1, 4);
+	memcpy(vendor+4, cpuInfo+3, 4);
+	memcpy(vendor+8, cpuInfo+2, 4);
+	vendor[12] = 0;
+	_cpuid(cpuInfo, 1);
+	// family/model/stepping
+	int fms = cpuInfo[0] & 0x0fff0fff;
+	
+	char brand[49] = {0};
+	_cpuid(cpuInfo, 0x80000000);
+	if((unsigned)cpuInfo[0] >= 0x80000004) {
+		for(int i=0; i<3; i++) {
+			_cpuid(cpuInfo, 0x80000002+i);
+			memcpy(brand + i*16, cpuInfo, 16);
+		}
+	}
+	// trim spaces from brand string
+	char* brandStart = brand;
+	while(*brandStart == ' ') brandStart++;
+	size_t brandLen = strlen(brandStart);
+	while(brandLen && brandStart[brandLen-1] == ' ') brandLen--;
+	brandStart[brandLen] = 0;
+	
+	// VMs can mask features on the same host CPU, so include the usable ISA extensions as well
+	const CpuCap caps(true);
+	unsigned features = (caps.hasSSE2 ? 1 : 0) | (caps.hasSSSE3 ? 2 : 0) | (caps.hasAVX ? 4 : 0) | (caps.hasAVX2 ? 8 : 0)
+		| (caps.hasAVX512VLBW ? 16 : 0) | (caps.hasAVX512VBMI ? 32 : 0) | (caps.hasGFNI ? 64 : 0) | (caps.canMemWX ? 128 : 0);
+	
+	snprintf(signature, sizeof(signature), "%s-%08x-%s-%02x", vendor, fms, brandStart, features);
+#else
+	const char* arch =
+# ifdef PLATFORM_ARM
+#  ifdef __aarch64__
+		"aarch64";
+#  else
+		"arm";
+#  endif
+# else
+		"generic";
+# endif
+	char midr[24] = {0};
+# ifdef __linux__
+	if(read_sysfs_line("/sys/devices/system/cpu/cpu0/regs/identification/midr_el1", midr, sizeof(midr))) {
+		size_t len = strlen(midr);
+		while(len && (midr[len-1] == '\n' || midr[len-1] == ' ')) midr[--len] = 0;
+	}
+# endif
+	unsigned features = 0;
+# ifdef PLATFORM_ARM
+	const CpuCap caps(true);
+	features = (caps.hasNEON ? 1 : 0) | (caps.hasSVE ? 2 : 0) | (caps.hasSVE2 ? 4 : 0);
+# endif
+	snprintf(signature, sizeof(signature), "%s-%s-%02x", arch, midr[0] ? midr : "unknown", features);
+#endif
+	return signature;
+}
+
 std::vector<Galois16Methods> Galois16Mul::availableMethods(bool checkCpuid) {
 	std::vector<Galois16Methods> ret;
 	ret.push_back(GF16_LOOKUP);
@@ -989,14 +1669,19 @@ std::vector<Galois16Methods> Galois16Mul::availableMethods(bool checkCpuid) {
 		ret.push_back(GF16_SHUFFLE_SSSE3);
 	if(gf16_shuffle_available_avx && caps.hasAVX)
 		ret.push_back(GF16_SHUFFLE_AVX);
+	if(gf16_shuffle_available_ssse3 && caps.hasSSSE3)
+		ret.push_back(GF16_SHUFFLE_NT_SSSE3);
 	if(gf16_shuffle_available_avx2 && caps.hasAVX2) {
 		ret.push_back(GF16_SHUFFLE_AVX2);
 		ret.push_back(GF16_SHUFFLE2X_AVX2);
+		ret.push_back(GF16_SHUFFLE_NT_AVX2);
 	}
 	if(gf16_shuffle_available_avx512 && caps.hasAVX512VLBW) {
 		ret.push_back(GF16_SHUFFLE_AVX512);
 		ret.push_back(GF16_SHUFFLE2X_AVX512);
 	}
+	if(gf16_shuffle_available_256_avx512 && caps.hasAVX512VLBW)
+		ret.push_back(GF16_SHUFFLE_256_AVX512);
 	if(gf16_shuffle_available_vbmi && caps.hasAVX512VBMI) {
 		ret.push_back(GF16_SHUFFLE_VBMI);
 	}
@@ -1005,15 +1690,19 @@ std::vector<Galois16Methods> Galois16Mul::availableMethods(bool checkCpuid) {
 		if(gf16_affine_available_gfni && gf16_shuffle_available_ssse3 && caps.hasSSSE3) {
 			ret.push_back(GF16_AFFINE_GFNI);
 			ret.push_back(GF16_AFFINE2X_GFNI);
+			ret.push_back(GF16_AFFINE_NT_GFNI);
 		}
 		if(gf16_affine_available_avx2 && gf16_shuffle_available_avx2 && caps.hasAVX2) {
 			ret.push_back(GF16_AFFINE_AVX2);
 			ret.push_back(GF16_AFFINE2X_AVX2);
+			ret.push_back(GF16_AFFINE_NT_AVX2);
 		}
 		if(gf16_affine_available_avx512 && gf16_shuffle_available_avx512 && caps.hasAVX512VLBW) {
 			ret.push_back(GF16_AFFINE_AVX512);
 			ret.push_back(GF16_AFFINE2X_AVX512);
 		}
+		if(gf16_affine_available_256_avx512 && gf16_shuffle_available_256_avx512 && caps.hasAVX512VLBW)
+			ret.push_back(GF16_AFFINE_256_AVX512);
 	}
 	
 	if(gf16_xor_available_sse2 && caps.hasSSE2) {
@@ -1023,8 +1712,8 @@ std::vector<Galois16Methods> Galois16Mul::availableMethods(bool checkCpuid) {
 	if(caps.canMemWX) {
 		if(gf16_xor_available_sse2 && caps.hasSSE2)
 			ret.push_back(GF16_XOR_JIT_SSE2);
-		//if(gf16_xor_available_avx && caps.hasAVX)
-		//	ret.push_back(GF16_XOR_JIT_AVX);
+		if(gf16_xor_available_avx && caps.hasAVX)
+			ret.push_back(GF16_XOR_JIT_AVX);
 		if(gf16_xor_available_avx2 && caps.hasAVX2)
 			ret.push_back(GF16_XOR_JIT_AVX2);
 		if(gf16_xor_available_avx512 && caps.hasAVX512VLBW)
@@ -15,7 +15,13 @@ typedef void(*Galois16PowFunc) (const void *HEDLEY_RESTRICT scratch, unsigned ou
 typedef unsigned(*Galois16MulMultiFunc) (const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch);
 typedef unsigned(*Galois16MulPackedFunc) (const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch);
 typedef void(*Galois16MulPackPfFunc) (const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut);
+typedef void(*Galois16MulPackPfExpFunc) (const void *HEDLEY_RESTRICT scratch, unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut);
+typedef void(*Galois16ExpandCoeffFunc) (const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count);
+typedef void(*Galois16CodeWriteFunc) (const void *HEDLEY_RESTRICT scratch, void *HEDLEY_RESTRICT cache, unsigned slot, uint16_t coefficient);
+typedef void(*Galois16MulCodeFunc) (const void *HEDLEY_RESTRICT code, void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT prefetch);
 typedef void(*Galois16AddFunc) (void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t len);
+typedef unsigned(*Galois16AddMultiFunc) (unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len);
+typedef unsigned(*Galois16AddPackedFunc) (unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len);
 
 
 
@@ -47,8 +53,15 @@ enum Galois16Methods {
 	GF16_AFFINE2X_AVX2,
 	GF16_AFFINE2X_AVX512,
 	GF16_CLMUL_NEON,
-	GF16_CLMUL_SVE2
-	// TODO: consider non-transforming shuffle/affine
+	GF16_CLMUL_SVE2,
+	GF16_SHUFFLE_256_AVX512,
+	GF16_AFFINE_256_AVX512,
+	GF16_SHUFFLE_NT_SSSE3,
+	GF16_SHUFFLE_NT_AVX2,
+	GF16_AFFINE_NT_GFNI,
+	GF16_AFFINE_NT_AVX2,
+	// method IDs are exposed to users (e.g. via tuning profiles), so new methods must be appended
+	GF16_XOR_JIT_AVX
 };
 static const char* Galois16MethodsText[] = {
 	"Auto",
@@ -78,8 +91,16 @@ static const char* Galois16MethodsText[] = {
 	"Affine2x (GFNI+AVX2)",
 	"Affine2x (GFNI+AVX512)",
 	"CLMul (NEON)",
-	"CLMul (SVE2)"
+	"CLMul (SVE2)",
+	"Shuffle-256 (AVX512)",
+	"Affine-256 (GFNI+AVX512)",
+	"Shuffle-NT (SSSE3)",
+	"Shuffle-NT (AVX2)",
+	"Affine-NT (GFNI)",
+	"Affine-NT (GFNI+AVX2)",
+	"Xor-Jit (AVX)"
 };
+#define GF16_NUM_METHODS (sizeof(Galois16MethodsText) / sizeof(*Galois16MethodsText))
 
 typedef struct {
 	Galois16Methods id;
@@ -89,8 +110,17 @@ typedef struct {
 	size_t idealChunkSize;
 	unsigned idealInputMultiple;
 	unsigned prefetchDownscale;
+	size_t expandedCoeffSize; // bytes per coefficient for expand_coefficients, 0 if the method doesn't support pre-expanded coefficients
+	size_t codeSlotSize; // bytes of executable memory per coefficient in a code cache, 0 if the method doesn't generate code
 } Galois16MethodInfo;
 
+typedef struct {
+	// sizes are in bytes, 0 if unknown
+	size_t sizeL1D, sizeL2, sizeL3;
+	// number of logical processors sharing each cache
+	unsigned sharesL1D, sharesL2, sharesL3;
+} Galois16CacheInfo;
+
 class Galois16Mul {
 private:
 	void* scratch;
@@ -101,11 +131,23 @@ private:
 	Galois16MulFunc _mul_add;
 	Galois16MulPfFunc _mul_add_pf;
 	Galois16AddFunc _add;
+	Galois16AddMultiFunc _add_multi;
+	Galois16AddPackedFunc _add_multi_packed;
+	Galois16AddMultiFunc _add_multi_store;
+	Galois16AddPackedFunc _add_multi_packed_store;
 	Galois16PowFunc _pow;
 	Galois16PowFunc _pow_add;
 	Galois16MulMultiFunc _mul_add_multi;
 	Galois16MulPackedFunc _mul_add_multi_packed;
 	Galois16MulPackPfFunc _mul_add_multi_packpf;
+	Galois16MulPackPfExpFunc _mul_add_multi_packpf_exp;
+	Galois16MulMultiFunc _mul_multi;
+	Galois16MulPackedFunc _mul_multi_packed;
+	Galois16MulPackPfFunc _mul_multi_packpf;
+	Galois16MulPackPfExpFunc _mul_multi_packpf_exp;
+	Galois16ExpandCoeffFunc _expand_coefficients;
+	Galois16CodeWriteFunc _code_write;
+	Galois16MulCodeFunc _mul_add_code;
 	
 	static unsigned _mul_add_multi_none(const void *HEDLEY_RESTRICT scratch, unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch);
 	static void _prepare_none(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t srcLen) {
@@ -116,6 +158,7 @@ private:
 	static void _finish_packed_none(void *HEDLEY_RESTRICT dst, const void *HEDLEY_RESTRICT src, size_t sliceLen, unsigned numOutputs, unsigned outputNum, size_t chunkLen);
 	
 	Galois16Methods _method;
+	int _jitOptStrat; // -1 = use CPU default
 	void setupMethod(Galois16Methods method);
 	
 	// disable copy constructor
@@ -128,7 +171,7 @@ private:
 	
 public:
 	static Galois16Methods default_method(size_t regionSizeHint = 0, unsigned outputs = 0, unsigned threadCountHint = 0);
-	Galois16Mul(Galois16Methods method = GF16_AUTO);
+	Galois16Mul(Galois16Methods method = GF16_AUTO, int jitOptStrat = -1);
 	~Galois16Mul();
 	
 #if __cplusplus >= 201100
@@ -147,11 +190,27 @@ public:
 	inline bool hasMultiMulAdd() const {
 		return _mul_add_multi != &Galois16Mul::_mul_add_multi_none;
 	};
+	// packed inputs can only be XORed if the method has a kernel for it, or doesn't interleave them
+	inline bool hasMultiAddPacked() const {
+		return _add_multi_packed != NULL || _mul_add_multi_packed == NULL;
+	};
 	inline bool hasPowAdd() const {
 		return _pow_add != NULL;
 	};
+	// SIMD methods provide pow and pow_add kernels which keep the running product in registers
+	inline bool hasPow() const {
+		return _pow != NULL && _pow_add != NULL;
+	};
+	inline bool hasExpandedCoefficients() const {
+		return _info.expandedCoeffSize != 0;
+	};
+	inline bool hasCodeCache() const {
+		return _code_write != NULL;
+	};
 	
 	static std::vector<Galois16Methods> availableMethods(bool checkCpuid);
+	static const Galois16CacheInfo& cacheInfo();
+	static const char* cpuSignature();
 	static inline const char* methodToText(Galois16Methods m) {
 		return Galois16MethodsText[(int)m];
 	}
@@ -351,4 +410,190 @@ public:
 		}
 	}
 	
+	// XOR of regions into the destination, equivalent to mul_add_multi with all coefficients being 1
+	inline void add_multi(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		
+		unsigned region = 0;
+		if(_add_multi)
+			region = _add_multi(regions, offset, dst, src, len);
+		for(; region<regions; region++) {
+			_add((uint8_t*)dst+offset, ((uint8_t*)src[region])+offset, len);
+		}
+	}
+	
+	inline void add_multi_packed(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		assert(hasMultiAddPacked());
+		
+		unsigned region = 0;
+		if(_add_multi_packed)
+			region = _add_multi_packed(regions, dst, src, len);
+		for(; region<regions; region++) {
+			_add(dst, (uint8_t*)src + region*len, len);
+		}
+	}
+	
+	// as add_multi/add_multi_packed, but overwrite the destination with the XOR of the regions, instead of clearing it and adding to it
+	inline void add_multi_store(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		
+		unsigned region = 0;
+		if(_add_multi_store)
+			region = _add_multi_store(regions, offset, dst, src, len);
+		if(region == 0) {
+			// no kernel, or too few regions for it, so copy the first region
+			memcpy((uint8_t*)dst+offset, ((uint8_t*)src[0])+offset, len);
+			region = 1;
+		}
+		for(; region<regions; region++) {
+			_add((uint8_t*)dst+offset, ((uint8_t*)src[region])+offset, len);
+		}
+	}
+	
+	inline void add_multi_packed_store(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		assert(hasMultiAddPacked());
+		
+		unsigned region = 0;
+		if(_add_multi_packed_store)
+			region = _add_multi_packed_store(regions, dst, src, len);
+		if(region == 0) {
+			memcpy(dst, src, len);
+			region = 1;
+		}
+		for(; region<regions; region++) {
+			_add(dst, (uint8_t*)src + region*len, len);
+		}
+	}
+	
+	// as the mul_add_multi variants, but overwrite the destination instead of adding to it
+	// methods without native support for this clear the destination first
+	inline void mul_multi(unsigned regions, size_t offset, void *HEDLEY_RESTRICT dst, const void* const*HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		
+		if(!_mul_multi) {
+			memset((uint8_t*)dst+offset, 0, len);
+			mul_add_multi(regions, offset, dst, src, len, coefficients, mutScratch);
+			return;
+		}
+		
+		unsigned region = _mul_multi(scratch, regions, offset, dst, src, len, coefficients, mutScratch);
+		if(region == 0) {
+			// too few regions for the kernel, so the first one needs to be stored separately
+			mul((uint8_t*)dst+offset, ((uint8_t*)src[0])+offset, len, coefficients[0], mutScratch);
+			region = 1;
+		}
+		for(; region<regions; region++) {
+			_mul_add(scratch, (uint8_t*)dst+offset, ((uint8_t*)src[region])+offset, len, coefficients[region], mutScratch);
+		}
+	}
+	
+	inline void mul_multi_packed(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		
+		if(!_mul_multi_packed) {
+			memset(dst, 0, len);
+			mul_add_multi_packed(regions, dst, src, len, coefficients, mutScratch);
+			return;
+		}
+		
+		unsigned region = _mul_multi_packed(scratch, regions, dst, src, len, coefficients, mutScratch);
+		if(region == 0) {
+			mul(dst, src, len, coefficients[0], mutScratch);
+			region = 1;
+		}
+		for(; region<regions; region++) {
+			_mul_add(scratch, dst, (uint8_t*)src + region*len, len, coefficients[region], mutScratch);
+		}
+	}
+	
+	inline void mul_multi_packpf(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const uint16_t *HEDLEY_RESTRICT coefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		
+		if(_mul_multi_packpf) {
+			_mul_multi_packpf(scratch, regions, dst, src, len, coefficients, mutScratch, prefetchIn, prefetchOut);
+			return;
+		}
+		memset(dst, 0, len);
+		mul_add_multi_packpf(regions, dst, src, len, coefficients, mutScratch, prefetchIn, prefetchOut);
+	}
+	
+	// methods which derive a table (e.g. a matrix) from each coefficient can have this done upfront, so that it can be re-used across calls
+	// writes info().expandedCoeffSize bytes per coefficient to dst, which must be aligned to 32 bytes
+	inline void expand_coefficients(void *HEDLEY_RESTRICT dst, const uint16_t *HEDLEY_RESTRICT coefficients, unsigned count) const {
+		assert(hasExpandedCoefficients());
+		assert(((uintptr_t)dst & 31) == 0);
+		_expand_coefficients(scratch, dst, coefficients, count);
+	}
+	// methods which generate code for each coefficient (XOR-JIT) can instead have it written upfront into an executable cache, shared by all threads
+	// the expanded coefficients for these are pointers to the code, as returned by codeCache_code (or NULL for a coefficient of 0)
+	void* codeCache_alloc(unsigned slots) const;
+	void codeCache_free(void* cache) const;
+	const void* codeCache_code(const void* cache, unsigned slot) const;
+	// different slots can be written concurrently, but a slot's code must not be run whilst it's being written
+	inline void codeCache_write(void* cache, unsigned slot, uint16_t coefficient) const {
+		assert(hasCodeCache());
+		_code_write(scratch, cache, slot, coefficient);
+	}
+	
+	// as mul_add_multi_packpf, but takes coefficients from expand_coefficients (or the code cache)
+	inline void mul_add_multi_packpf_exp(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		assert(hasExpandedCoefficients());
+		
+		if(_mul_add_multi_packpf_exp) {
+			_mul_add_multi_packpf_exp(scratch, regions, dst, src, len, expCoefficients, mutScratch, prefetchIn, prefetchOut);
+			return;
+		}
+		
+		// run cached code for each region, prefetching the same way as mul_add_multi_packpf
+		// the cached code always prefetches, so if there's nothing to prefetch, it's pointed at the source
+		const void* const* code = (const void* const*)expCoefficients;
+		size_t pfLen = len>>_info.prefetchDownscale;
+		const char* _pf = (const char*)prefetchOut;
+		unsigned outputPfRounds = 1<<_info.prefetchDownscale;
+		for(unsigned region = 0; region<regions; region++) {
+			const uint8_t* regionSrc = (const uint8_t*)src + region*len;
+			if(code[region])
+				_mul_add_code(code[region], dst, regionSrc, len, _pf ? _pf : (const char*)regionSrc);
+			if(_pf) {
+				_pf += pfLen;
+				// once the output is prefetched, move on to inputs
+				if(outputPfRounds && --outputPfRounds == 0)
+					_pf = (const char*)prefetchIn;
+			}
+		}
+	}
+	
+	inline void mul_multi_packpf_exp(unsigned regions, void *HEDLEY_RESTRICT dst, const void* HEDLEY_RESTRICT src, size_t len, const void *HEDLEY_RESTRICT expCoefficients, void *HEDLEY_RESTRICT mutScratch, const void* HEDLEY_RESTRICT prefetchIn, const void* HEDLEY_RESTRICT prefetchOut) const {
+		assert(isMultipleOfStride(len));
+		assert(len > 0);
+		assert(regions > 0);
+		assert(hasExpandedCoefficients());
+		
+		if(_mul_multi_packpf_exp) {
+			_mul_multi_packpf_exp(scratch, regions, dst, src, len, expCoefficients, mutScratch, prefetchIn, prefetchOut);
+			return;
+		}
+		memset(dst, 0, len);
+		mul_add_multi_packpf_exp(regions, dst, src, len, expCoefficients, mutScratch, prefetchIn, prefetchOut);
+	}
+	
 };
@@ -1,5 +1,8 @@
 #include "gfmat_coeff.h"
 #include <stdlib.h>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
 
 static int8_t* input_diff; // difference between predicted input coefficient and actual (number range is -4...5, so could be compressed to 4 bits, but I don't feel it's worth the savings)
 static uint16_t* gf_exp; // pre-calculated exponents in GF(2^16), missing bottom 3 bits, followed by 128-entry polynomial shift table
@@ -56,3 +59,71 @@ HEDLEY_CONST uint16_t gfmat_coeff(uint_fast16_t inputBlock, uint_fast16_t recove
 	
 	return gf16_exp(result);
 }
+
+// addition modulo 65535, via one's complement (end around carry); 65535 is returned in place of 0, which gf16_exp handles fine
+static HEDLEY_ALWAYS_INLINE uint16_t add_mod65535(uint16_t a, uint16_t b) {
+	uint16_t sum = a + b;
+	return sum + (sum < a);
+}
+#ifdef __SSE2__
+static HEDLEY_ALWAYS_INLINE __m128i add_mod65535_sse2(__m128i a, __m128i b) {
+	__m128i sum = _mm_add_epi16(a, b);
+	// carry = sum < a (unsigned), which SSE2 can only compare as signed
+	__m128i bias = _mm_set1_epi16(-0x8000);
+	__m128i carry = _mm_cmplt_epi16(_mm_xor_si128(sum, bias), _mm_xor_si128(a, bias));
+	return _mm_sub_epi16(sum, carry);
+}
+#endif
+
+// computes the coefficient matrix for the given input and recovery blocks, with the coefficient for input i and output o written to dst[o*stride + i]
+// exponents are computed in the log domain across all inputs at once; if the recovery block number is one more than the previous, the exponents are just a running add of the input logs
+void gfmat_coeff_fill(uint16_t* dst, unsigned stride, const uint_fast16_t* iNums, unsigned numInputs, const uint_fast16_t* oNums, unsigned numOutputs) {
+	if(!numInputs || !numOutputs) return;
+	// pad to a multiple of 8 so that the SIMD loops don't need to handle a remainder
+	unsigned numInputsAligned = (numInputs + 7) & ~7;
+	uint16_t* inLog = (uint16_t*)malloc(numInputsAligned * 2 * sizeof(uint16_t));
+	uint16_t* exps = inLog + numInputsAligned;
+	unsigned i;
+	for(i = 0; i < numInputs; i++)
+		inLog[i] = iNums[i]*2 + input_diff[iNums[i]];
+	for(; i < numInputsAligned; i++)
+		inLog[i] = 0;
+	
+	for(unsigned out = 0; out < numOutputs; out++) {
+		uint16_t recoveryBlock = oNums[out];
+		//assert(recoveryBlock < 65535); // if ==65535, gets an invalid exponent
+		if(out && oNums[out-1] + 1 == oNums[out]) {
+			// log(coeff^(n+1)) = log(coeff^n) + log(coeff)
+#ifdef __SSE2__
+			for(i = 0; i < numInputsAligned; i += 8) {
+				__m128i e = _mm_loadu_si128((__m128i*)(exps + i));
+				__m128i l = _mm_loadu_si128((__m128i*)(inLog + i));
+				_mm_storeu_si128((__m128i*)(exps + i), add_mod65535_sse2(e, l));
+			}
+#else
+			for(i = 0; i < numInputsAligned; i++)
+				exps[i] = add_mod65535(exps[i], inLog[i]);
+#endif
+		} else {
+			// log(coeff^n) = log(coeff) * n mod 65535; as 65536 == 1 (mod 65535), this is just the sum of the high and low halves of the product
+#ifdef __SSE2__
+			__m128i n = _mm_set1_epi16(recoveryBlock);
+			for(i = 0; i < numInputsAligned; i += 8) {
+				__m128i l = _mm_loadu_si128((__m128i*)(inLog + i));
+				__m128i e = add_mod65535_sse2(_mm_mullo_epi16(l, n), _mm_mulhi_epu16(l, n));
+				_mm_storeu_si128((__m128i*)(exps + i), e);
+			}
+#else
+			for(i = 0; i < numInputsAligned; i++) {
+				uint32_t product = (uint32_t)inLog[i] * recoveryBlock;
+				exps[i] = add_mod65535(product & 65535, product >> 16);
+			}
+#endif
+		}
+		
+		uint16_t* row = dst + out*stride;
+		for(i = 0; i < numInputs; i++)
+			row[i] = gf16_exp(exps[i]);
+	}
+	free(inLog);
+}
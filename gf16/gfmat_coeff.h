@@ -11,6 +11,7 @@ extern "C" {
 void gfmat_init();
 HEDLEY_CONST uint16_t gfmat_coeff(uint_fast16_t inputBlock, uint_fast16_t recoveryBlock);
 HEDLEY_CONST uint16_t gf16_exp(uint_fast16_t v);
+void gfmat_coeff_fill(uint16_t* dst, unsigned stride, const uint_fast16_t* iNums, unsigned numInputs, const uint_fast16_t* oNums, unsigned numOutputs);
 
 #ifdef __cplusplus
 }
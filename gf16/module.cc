@@ -1,60 +1,546 @@
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 #include "../src/stdint.h"
+#include "../src/threadpool.h"
+#include "module.h"
 #include <string.h>
 #include <stdlib.h>
+#include <list>
+#include <algorithm>
 #include "gf16mul.h"
 
 #define CACHELINE_SIZE 64
 
+#if defined(__cplusplus) && __cplusplus >= 201100 && !(defined(_MSC_VER) && defined(__clang__)) && !defined(__APPLE__)
+	// C++11 method
+	// len needs to be a multiple of alignment, although it sometimes works if it isn't...
+	#include <cstdlib>
+	#define ALIGN_ALLOC(buf, len, align) *(void**)&(buf) = aligned_alloc(align, ((len) + (align)-1) & ~((align)-1))
+	#define ALIGN_FREE free
+#elif defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
+	#define ALIGN_ALLOC(buf, len, align) *(void**)&(buf) = _aligned_malloc((len), align)
+	#define ALIGN_FREE _aligned_free
+#else
+	#include <stdlib.h>
+	#define ALIGN_ALLOC(buf, len, align) if(posix_memalign((void**)&(buf), align, (len))) (buf) = NULL
+	#define ALIGN_FREE free
+#endif
+
 #include "gfmat_coeff.h"
 void ppgf_init_constants() {
 	gfmat_init();
 }
 
-static Galois16Mul* gf = NULL;
-static std::vector<void*> gfScratch;
-
+// all engines share a single thread pool; jobs submitted from different engines are interleaved in its queues
+static ThreadPool* pool = NULL;
+// standalone hashing (not tied to GF computation) gets its own workers, so that it isn't queued behind long running GF jobs, which would otherwise delay reading further data
+static ThreadPool* hashPool = NULL;
 static int maxNumThreads = 1, defaultNumThreads = 1;
 
-static void setup_gf(Galois16Methods method = GF16_AUTO, size_t size_hint = 0) {
-	if(!gfScratch.empty()) {
-		for(unsigned i=0; i<gfScratch.size(); i++)
-			if(gfScratch[i])
-				gf->mutScratch_free(gfScratch[i]);
-		gfScratch.clear();
+// coefficient matrix for a set of inputs and recovery blocks; the factor for input i and output o is at factors[o*stride + i]
+// matrices are shared between the engine's cache and jobs using them, and freed once no longer referenced
+struct coeff_matrix {
+	std::vector<uint16_t> iNums, oNums;
+	unsigned int stride;
+	uint16_t* factors;
+	// outputs for which every factor is 1 (recovery exponent 0); these are computed by XORing the inputs instead of multiplying
+	// in PAR2, no other factors can be 1, as every input constant has maximal order
+	std::vector<bool> unitRows;
+	// factors expanded into the engine's method-specific tables (laid out the same way), so that kernels don't need to re-derive them for every chunk; NULL if not supported by the method
+	// only the affine methods (matrices) and XOR-JIT (code cache) support this, and only for packed jobs; shuffle methods build their lookup tables in registers, per call, and the unpacked kernels have no variant taking expanded factors
+	// the first job to use the matrix fills these in, after which later jobs can use them
+	void* expanded;
+	int expandState;
+	// for methods which generate code, the expanded factors point into this cache, which holds the code for each distinct factor (listed in codeFactors, in slot order)
+	void* codeCache;
+	std::vector<uint16_t> codeFactors;
+	size_t size; // memory used by factors + expanded + codeCache
+	unsigned int refs;
+};
+enum {
+	COEFF_EXPAND_NONE,
+	COEFF_EXPAND_RUNNING,
+	COEFF_EXPAND_READY
+};
+
+// matrices are cached, up to this total size, as the same input/recovery sets are often used repeatedly (e.g. each chunk pass)
+#define COEFF_CACHE_SIZE (16*1024*1024)
+// matrices larger than this don't get expanded, to limit memory usage
+#define COEFF_EXPAND_MAX_SIZE (32*1024*1024)
+// number of code cache slots written per item, when expanding
+#define CODE_CACHE_ITEM_SLOTS 64
+// jobs with at most this many inputs, and at least this many outputs per input, are processed input-major if the method has native pow kernels
+// with more than one input, output-major processing wins, as each output is then only written once
+#define POW_MAX_INPUTS 1
+#define POW_MIN_OUTPUT_RATIO 32
+#define POW_BATCH_OUTPUTS 16
+
+// an engine holds a GF method and everything derived from it, so that multiple methods/jobs can be used concurrently
+struct ppgf_engine {
+	Galois16Mul* gf;
+	std::vector<void*> scratch; // indexed by the pool's thread number
+	size_t chunkSizeOverride; // 0 = use method's ideal chunk size
+	
+	// most recently used first
+	std::list<coeff_matrix*> coeffCache;
+	size_t coeffCacheSize;
+	uv_mutex_t coeffMutex; // matrices are released from worker threads
+};
+
+static void release_coeff_matrix(ppgf_engine* engine, coeff_matrix* matrix) {
+	uv_mutex_lock(&engine->coeffMutex);
+	bool unused = (--matrix->refs == 0);
+	uv_mutex_unlock(&engine->coeffMutex);
+	if(unused) {
+		delete[] matrix->factors;
+		if(matrix->expanded) ALIGN_FREE(matrix->expanded);
+		if(matrix->codeCache) engine->gf->codeCache_free(matrix->codeCache);
+		delete matrix;
+	}
+}
+static void flush_coeff_cache(ppgf_engine* engine) {
+	std::list<coeff_matrix*> cache;
+	uv_mutex_lock(&engine->coeffMutex);
+	cache.swap(engine->coeffCache);
+	engine->coeffCacheSize = 0;
+	uv_mutex_unlock(&engine->coeffMutex);
+	for(std::list<coeff_matrix*>::iterator it = cache.begin(); it != cache.end(); ++it)
+		release_coeff_matrix(engine, *it);
+}
+// assigns a code cache slot to each distinct factor, and points the expanded factors at them; the code itself is written when expanding
+// returns false if the cache couldn't be allocated
+static bool setup_code_cache(const Galois16Mul* gf, coeff_matrix* matrix, unsigned int numOutputs) {
+	std::vector<uint32_t> slots(65536, 0); // slot+1 for each factor seen
+	unsigned int count = matrix->stride * numOutputs;
+	for(unsigned i=0; i<count; i++) {
+		uint16_t factor = matrix->factors[i];
+		if(factor && !slots[factor]) {
+			matrix->codeFactors.push_back(factor);
+			slots[factor] = (uint32_t)matrix->codeFactors.size();
+		}
 	}
-	delete gf;
-	gf = new Galois16Mul(method);
+	size_t cacheSize = matrix->codeFactors.size() * gf->info().codeSlotSize;
+	if(!cacheSize || cacheSize > COEFF_EXPAND_MAX_SIZE) return false;
+	matrix->codeCache = gf->codeCache_alloc((unsigned)matrix->codeFactors.size());
+	if(!matrix->codeCache) return false;
+	matrix->size += cacheSize;
 	
-	gfScratch.reserve(maxNumThreads);
-	for(int i=0; i<maxNumThreads; i++)
-		gfScratch.push_back(gf->mutScratch_alloc());
+	const void** code = (const void**)matrix->expanded;
+	for(unsigned i=0; i<count; i++) {
+		uint16_t factor = matrix->factors[i];
+		code[i] = factor ? gf->codeCache_code(matrix->codeCache, slots[factor]-1) : NULL;
+	}
+	return true;
+}
+// returns the coefficient matrix for the inputs/outputs, computing it if not already cached; the matrix must be released after use
+// stride must be >= numInputs; any factors beyond numInputs in a row are zeroed
+static coeff_matrix* get_coeff_matrix(ppgf_engine* engine, const uint_fast16_t* iNums, unsigned int numInputs, unsigned int stride, const uint_fast16_t* oNums, unsigned int numOutputs) {
+	uv_mutex_lock(&engine->coeffMutex);
+	for(std::list<coeff_matrix*>::iterator it = engine->coeffCache.begin(); it != engine->coeffCache.end(); ++it) {
+		coeff_matrix* matrix = *it;
+		if(matrix->stride != stride || matrix->iNums.size() != numInputs || matrix->oNums.size() != numOutputs)
+			continue;
+		if(!std::equal(matrix->iNums.begin(), matrix->iNums.end(), iNums) || !std::equal(matrix->oNums.begin(), matrix->oNums.end(), oNums))
+			continue;
+		engine->coeffCache.splice(engine->coeffCache.begin(), engine->coeffCache, it);
+		matrix->refs++;
+		uv_mutex_unlock(&engine->coeffMutex);
+		return matrix;
+	}
+	uv_mutex_unlock(&engine->coeffMutex);
+	
+	coeff_matrix* matrix = new coeff_matrix;
+	matrix->iNums.assign(iNums, iNums + numInputs);
+	matrix->oNums.assign(oNums, oNums + numOutputs);
+	matrix->stride = stride;
+	matrix->factors = new uint16_t[stride * numOutputs];
+	matrix->refs = 1;
+	// pre-calc all coefficients
+	// calculation does lookups, so faster to do it first and avoid memory penalties later on
+	gfmat_coeff_fill(matrix->factors, stride, iNums, numInputs, oNums, numOutputs);
+	if(stride > numInputs)
+		for(unsigned out=0; out<numOutputs; out++)
+			memset(matrix->factors + out*stride + numInputs, 0, (stride - numInputs) * sizeof(uint16_t));
+	matrix->size = stride * numOutputs * sizeof(uint16_t);
+	matrix->unitRows.resize(numOutputs);
+	for(unsigned out=0; out<numOutputs; out++) {
+		const uint16_t* row = matrix->factors + out*stride;
+		matrix->unitRows[out] = std::count(row, row + numInputs, 1) == (ptrdiff_t)numInputs;
+	}
+	
+	// the expanded tables are only allocated here; they're computed by the first job using the matrix (see submit_mat_job)
+	matrix->expanded = NULL;
+	matrix->expandState = COEFF_EXPAND_NONE;
+	matrix->codeCache = NULL;
+	size_t expandedSize = stride * numOutputs * engine->gf->info().expandedCoeffSize;
+	if(expandedSize && expandedSize <= COEFF_EXPAND_MAX_SIZE) {
+		ALIGN_ALLOC(matrix->expanded, expandedSize, 64);
+		if(matrix->expanded) matrix->size += expandedSize;
+		if(matrix->expanded && engine->gf->hasCodeCache() && !setup_code_cache(engine->gf, matrix, numOutputs)) {
+			ALIGN_FREE(matrix->expanded);
+			matrix->expanded = NULL;
+			matrix->size -= expandedSize;
+			matrix->codeFactors.clear();
+		}
+	}
+	
+	if(matrix->size > COEFF_CACHE_SIZE) return matrix;
+	uv_mutex_lock(&engine->coeffMutex);
+	matrix->refs++;
+	engine->coeffCache.push_front(matrix);
+	engine->coeffCacheSize += matrix->size;
+	std::vector<coeff_matrix*> evicted;
+	while(engine->coeffCacheSize > COEFF_CACHE_SIZE) {
+		coeff_matrix* oldest = engine->coeffCache.back();
+		engine->coeffCache.pop_back();
+		engine->coeffCacheSize -= oldest->size;
+		evicted.push_back(oldest);
+	}
+	uv_mutex_unlock(&engine->coeffMutex);
+	for(unsigned i=0; i<evicted.size(); i++)
+		release_coeff_matrix(engine, evicted[i]);
+	return matrix;
+}
+
+static void engine_free_scratch(ppgf_engine* engine) {
+	for(unsigned i=0; i<engine->scratch.size(); i++)
+		if(engine->scratch[i])
+			engine->gf->mutScratch_free(engine->scratch[i]);
+	engine->scratch.clear();
 }
-void ppgf_maybe_setup_gf() {
-	if(!gf) setup_gf();
+static void setup_gf(ppgf_engine* engine, Galois16Methods method, size_t size_hint, int jitOptStrat) {
+	if(engine->gf) {
+		engine_free_scratch(engine);
+		flush_coeff_cache(engine); // expanded coefficients are specific to the method
+		delete engine->gf;
+	}
+	if(method == GF16_AUTO)
+		method = Galois16Mul::default_method(size_hint, 0, maxNumThreads);
+	engine->gf = new Galois16Mul(method, jitOptStrat);
+}
+// scratch is allocated lazily, at job submission, to cover all threads in the pool
+// as the number of threads can't change whilst jobs are in flight, this never reallocates scratch in use
+static void engine_ensure_scratch(ppgf_engine* engine) {
+	if(engine->scratch.size() >= (unsigned)maxNumThreads) return;
+	engine->scratch.reserve(maxNumThreads);
+	for(unsigned i=engine->scratch.size(); i<(unsigned)maxNumThreads; i++)
+		engine->scratch.push_back(engine->gf->mutScratch_alloc());
+}
+
+ppgf_engine* ppgf_engine_create() {
+	ppgf_engine* engine = new ppgf_engine;
+	engine->gf = NULL;
+	engine->chunkSizeOverride = 0;
+	engine->coeffCacheSize = 0;
+	uv_mutex_init(&engine->coeffMutex);
+	setup_gf(engine, GF16_AUTO, 0, -1);
+	return engine;
+}
+// the engine must not have any jobs in flight
+void ppgf_engine_destroy(ppgf_engine* engine) {
+	flush_coeff_cache(engine);
+	uv_mutex_destroy(&engine->coeffMutex);
+	engine_free_scratch(engine);
+	delete engine->gf;
+	delete engine;
 }
 
 
-#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#ifndef MIN // may already be defined by system headers
+# define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
 #define CEIL_DIV(a, b) (((a) + (b)-1) / (b))
 #define ROUND_DIV(a, b) (((a) + ((b)>>1)) / (b))
 
-#if defined(__cplusplus) && __cplusplus >= 201100 && !(defined(_MSC_VER) && defined(__clang__)) && !defined(__APPLE__)
-	// C++11 method
-	// len needs to be a multiple of alignment, although it sometimes works if it isn't...
-	#include <cstdlib>
-	#define ALIGN_ALLOC(buf, len, align) *(void**)&(buf) = aligned_alloc(align, ((len) + (align)-1) & ~((align)-1))
-	#define ALIGN_FREE free
-#elif defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
-	#define ALIGN_ALLOC(buf, len, align) *(void**)&(buf) = _aligned_malloc((len), align)
-	#define ALIGN_FREE _aligned_free
-#else
-	#include <stdlib.h>
-	#define ALIGN_ALLOC(buf, len, align) if(posix_memalign((void**)&(buf), align, (len))) (buf) = NULL
-	#define ALIGN_FREE free
-#endif
+// break the slice into smaller chunks so that we maximise CPU cache usage
+// the packed layout depends on this, so it must only be a function of the slice length
+static size_t get_chunk_size(const ppgf_engine* engine, size_t len) {
+	int numChunks = ROUND_DIV(len, engine->chunkSizeOverride ? engine->chunkSizeOverride : engine->gf->info().idealChunkSize);
+	if(numChunks < 1) numChunks = 1;
+	return engine->gf->alignToStride(CEIL_DIV(len, numChunks)); // we'll assume that input chunks are memory aligned here
+}
+
+// approximate amount of (L2) cache we can fill with input data
+static size_t tileCacheSize = 256*1024;
+static bool useTiling = true;
+
+// derive the tile size from the L2 cache available to each thread; half of it is left for outputs and everything else
+static void update_tile_size() {
+	const Galois16CacheInfo& cache = Galois16Mul::cacheInfo();
+	if(!cache.sizeL2) {
+		tileCacheSize = 256*1024;
+		return;
+	}
+	unsigned shares = cache.sharesL2 ? cache.sharesL2 : 1;
+	unsigned numL2 = defaultNumThreads > (int)shares ? defaultNumThreads / shares : 1;
+	unsigned threadsPerL2 = CEIL_DIV((unsigned)maxNumThreads, numL2);
+	if(threadsPerL2 > shares) threadsPerL2 = shares;
+	if(threadsPerL2 < 1) threadsPerL2 = 1;
+	tileCacheSize = cache.sizeL2 / threadsPerL2 / 2;
+	if(tileCacheSize < 64*1024) tileCacheSize = 64*1024;
+}
+
+// work is split up into items of (chunk, group of outputs); each item runs through a tile of inputs across all outputs in its group, before moving to the next tile
+// this allows an input tile to stay in cache whilst it's applied to several outputs, rather than being re-read from memory for every output
+struct tile_schedule {
+	size_t chunkSize;
+	unsigned numChunks;
+	unsigned tileInputs;
+	unsigned outGroupSize;
+	unsigned numOutGroups;
+	unsigned numItems;
+};
+static void get_tile_schedule(const ppgf_engine* engine, struct tile_schedule* sched, size_t len, unsigned numInputs, unsigned numOutputs) {
+	sched->chunkSize = get_chunk_size(engine, len);
+	sched->numChunks = CEIL_DIV(len, sched->chunkSize);
+	
+	if(!useTiling) {
+		// non-tiled: each item streams all inputs for a single output
+		sched->tileInputs = numInputs;
+		sched->outGroupSize = 1;
+		sched->numOutGroups = numOutputs;
+		sched->numItems = numOutputs * sched->numChunks;
+		return;
+	}
+	
+	// tiles must be a multiple of idealInputMultiple to not break up packed input groups
+	unsigned multiple = engine->gf->info().idealInputMultiple;
+	unsigned tileInputs = (unsigned)(tileCacheSize / sched->chunkSize);
+	tileInputs -= tileInputs % multiple;
+	if(tileInputs < multiple) tileInputs = multiple;
+	if(tileInputs < numInputs) {
+		// even out tile sizes
+		unsigned numTiles = CEIL_DIV(numInputs, tileInputs);
+		tileInputs = CEIL_DIV(CEIL_DIV(numInputs, numTiles), multiple) * multiple;
+	}
+	if(tileInputs > numInputs) tileInputs = numInputs;
+	sched->tileInputs = tileInputs;
+	
+	// split outputs into groups only to the extent needed to give all threads something to do
+	unsigned numOutGroups = CEIL_DIV(maxNumThreads*2, sched->numChunks);
+	if(numOutGroups > numOutputs) numOutGroups = numOutputs;
+	if(numOutGroups < 1) numOutGroups = 1;
+	sched->outGroupSize = CEIL_DIV(numOutputs, numOutGroups);
+	sched->numOutGroups = CEIL_DIV(numOutputs, sched->outGroupSize);
+	sched->numItems = sched->numOutGroups * sched->numChunks;
+}
+
+// parameters of a multiply job, shared by all items processed by the thread pool
+// jobs are heap allocated, as they outlive the call which submitted them if run asynchronously
+struct mat_job {
+	ppgf_engine* engine;
+	const void* const* inputs;
+	const void* packedInput;
+	unsigned int numInputs; // for packed inputs, this is the number of regions
+	size_t len;
+	void** outputs;
+	unsigned int numOutputs;
+	int add;
+	coeff_matrix* coeffs;
+	const uint16_t* factors;
+	const void* expanded; // factors expanded by the method, if available (packed jobs only)
+	unsigned int packSize;
+	// pow jobs only: working buffers for each thread (indexed by thread number), each holding the scaled input, followed by the unpacked input for packed jobs
+	void* powBuffers;
+	size_t powBufferSize; // size of each buffer
+	struct tile_schedule sched;
+	ppgf_done_callback done;
+	void* doneArg;
+};
+
+static void mat_job_done(void* arg) {
+	struct mat_job* job = (struct mat_job*)arg;
+	ppgf_done_callback done = job->done;
+	void* doneArg = job->doneArg;
+	release_coeff_matrix(job->engine, job->coeffs);
+	if(job->powBuffers) ALIGN_FREE(job->powBuffers);
+	delete job;
+	if(done) done(doneArg);
+}
+
+// expansion of a matrix's coefficients is done as a separate pass before the job, one output row (or CODE_CACHE_ITEM_SLOTS code cache slots) per item
+struct expand_job {
+	struct mat_job* job;
+	ThreadPool::TaskFunc func;
+};
+static unsigned expand_coeffs_num_items(const struct mat_job* job) {
+	if(job->coeffs->codeCache)
+		return CEIL_DIV((unsigned)job->coeffs->codeFactors.size(), CODE_CACHE_ITEM_SLOTS);
+	return job->numOutputs;
+}
+static void expand_coeffs_item(void* arg, unsigned item, unsigned) {
+	const coeff_matrix* matrix = ((struct expand_job*)arg)->job->coeffs;
+	const Galois16Mul* gf = ((struct expand_job*)arg)->job->engine->gf;
+	if(matrix->codeCache) {
+		unsigned slotEnd = MIN((item+1) * CODE_CACHE_ITEM_SLOTS, (unsigned)matrix->codeFactors.size());
+		for(unsigned slot = item * CODE_CACHE_ITEM_SLOTS; slot < slotEnd; slot++)
+			gf->codeCache_write(matrix->codeCache, slot, matrix->codeFactors[slot]);
+	} else
+		gf->expand_coefficients((uint8_t*)matrix->expanded + item * matrix->stride * gf->info().expandedCoeffSize, matrix->factors + item * matrix->stride, matrix->stride);
+}
+static void expand_coeffs_done(void* arg) {
+	struct expand_job* ejob = (struct expand_job*)arg;
+	struct mat_job* job = ejob->job;
+	ThreadPool::TaskFunc func = ejob->func;
+	delete ejob;
+	
+	uv_mutex_lock(&job->engine->coeffMutex);
+	job->coeffs->expandState = COEFF_EXPAND_READY;
+	uv_mutex_unlock(&job->engine->coeffMutex);
+	job->expanded = job->coeffs->expanded;
+	
+	if(job->done)
+		pool->submit(job->sched.numItems, func, job, &mat_job_done, job);
+}
+
+// runs the job on the pool; if the job has no completion callback, blocks until it's complete
+// if useExpanded is set, the job uses the matrix's expanded coefficients if available, computing them first if no other job has
+static void submit_mat_job(struct mat_job* job, ThreadPool::TaskFunc func, bool useExpanded) {
+	engine_ensure_scratch(job->engine);
+	
+	job->expanded = NULL;
+	bool expand = false;
+	coeff_matrix* matrix = job->coeffs;
+	if(useExpanded && matrix->expanded) {
+		uv_mutex_lock(&job->engine->coeffMutex);
+		if(matrix->expandState == COEFF_EXPAND_READY)
+			job->expanded = matrix->expanded;
+		else if(matrix->expandState == COEFF_EXPAND_NONE) {
+			matrix->expandState = COEFF_EXPAND_RUNNING;
+			expand = true;
+		}
+		// if another job is currently expanding the matrix, just fall back to the regular coefficients
+		uv_mutex_unlock(&job->engine->coeffMutex);
+	}
+	
+	if(expand) {
+		struct expand_job* ejob = new struct expand_job;
+		ejob->job = job;
+		ejob->func = func;
+		if(job->done) {
+			// the job gets submitted once expansion completes
+			pool->submit(expand_coeffs_num_items(job), &expand_coeffs_item, ejob, &expand_coeffs_done, ejob);
+			return;
+		}
+		pool->run(expand_coeffs_num_items(job), &expand_coeffs_item, ejob);
+		expand_coeffs_done(ejob);
+	}
+	if(job->done)
+		pool->submit(job->sched.numItems, func, job, &mat_job_done, job);
+	else {
+		pool->run(job->sched.numItems, func, job);
+		mat_job_done(job);
+	}
+}
+
+static void multiply_mat_item(void* arg, unsigned loop, unsigned threadNum) {
+	const struct mat_job& job = *(const struct mat_job*)arg;
+	const struct tile_schedule& sched = job.sched;
+	Galois16Mul* gf = job.engine->gf;
+	size_t offset = (loop / sched.numOutGroups) * sched.chunkSize;
+	unsigned int outStart = (loop % sched.numOutGroups) * sched.outGroupSize;
+	unsigned int outEnd = MIN(outStart + sched.outGroupSize, job.numOutputs);
+	int procSize = MIN(job.len-offset, sched.chunkSize);
+	
+	for(unsigned tile = 0; tile < job.numInputs; tile += sched.tileInputs) {
+		unsigned tileInputs = MIN(sched.tileInputs, job.numInputs - tile);
+		for(unsigned out = outStart; out < outEnd; out++) {
+			const bool store = !job.add && !tile;
+			if(job.coeffs->unitRows[out]) {
+				if(store)
+					gf->add_multi_store(tileInputs, offset, job.outputs[out], job.inputs + tile, procSize);
+				else
+					gf->add_multi(tileInputs, offset, job.outputs[out], job.inputs + tile, procSize);
+			} else if(store)
+				gf->mul_multi(tileInputs, offset, job.outputs[out], job.inputs + tile, procSize, job.factors + out*job.numInputs + tile, job.engine->scratch[threadNum]);
+			else
+				gf->mul_add_multi(tileInputs, offset, job.outputs[out], job.inputs + tile, procSize, job.factors + out*job.numInputs + tile, job.engine->scratch[threadNum]);
+		}
+	}
+}
+
+// copies a single input's chunk out of a packed buffer (as laid out by gf16_prepare_packed), where inputs are interleaved a stride at a time, in groups of idealInputMultiple
+// the final group holds the remaining inputs, if packSize isn't a multiple of the group size
+static void unpack_chunk_input(const Galois16Mul* gf, void* dst, const uint8_t* chunk, size_t procSize, unsigned packSize, unsigned input) {
+	const Galois16MethodInfo& info = gf->info();
+	unsigned groupSize = info.idealInputMultiple;
+	unsigned interleaveBy = (input >= packSize - (packSize % groupSize)) ? packSize % groupSize : groupSize;
+	const uint8_t* src = chunk + (input/groupSize) * procSize * groupSize + (input%groupSize) * info.stride;
+	for(size_t pos = 0; pos < procSize; pos += info.stride)
+		memcpy((uint8_t*)dst + pos, src + pos*interleaveBy, info.stride);
+}
+
+// input-major alternative to multiply_mat_item/multiply_mat_packed_item, for jobs with few inputs but many consecutive recovery exponents
+// each input is multiplied by successive powers of its constant (held in registers by the method's pow kernel), rather than each output reading all inputs
+static void multiply_mat_pow_item(void* arg, unsigned loop, unsigned threadNum) {
+	const struct mat_job& job = *(const struct mat_job*)arg;
+	const struct tile_schedule& sched = job.sched;
+	Galois16Mul* gf = job.engine->gf;
+	size_t offset = (loop / sched.numOutGroups) * sched.chunkSize;
+	unsigned int outStart = (loop % sched.numOutGroups) * sched.outGroupSize;
+	unsigned int outEnd = MIN(outStart + sched.outGroupSize, job.numOutputs);
+	int procSize = MIN(job.len-offset, sched.chunkSize);
+	void* scratch = job.engine->scratch[threadNum];
+	// packed jobs may include padding slots, which are skipped
+	unsigned numInputs = (unsigned)job.coeffs->iNums.size();
+	uint8_t* buffers = (uint8_t*)job.powBuffers + threadNum * job.powBufferSize * (job.packedInput ? 2 : 1);
+	void* scaled = buffers; // input multiplied up to the batch's first exponent
+	// the pow kernels need a contiguous source, so packed inputs are first copied out of their group
+	void* unpacked = buffers + job.powBufferSize;
+	unsigned unpackedInput = numInputs; // which input is currently held in unpacked
+	
+	// outputs are processed in batches, as the kernel writes to all of its outputs in lockstep
+	unsigned batchSize = POW_BATCH_OUTPUTS;
+	void* dst[POW_BATCH_OUTPUTS];
+	
+	for(unsigned batch = outStart; batch < outEnd; batch += batchSize) {
+		unsigned batchOutputs = MIN(batchSize, outEnd - batch);
+		for(unsigned out = 0; out < batchOutputs; out++)
+			dst[out] = ((uint8_t*)job.outputs[batch + out]) + offset;
+		uint16_t exponent = job.coeffs->oNums[batch];
+		
+		for(unsigned in = 0; in < numInputs; in++) {
+			const bool store = !job.add && !in;
+			const void* src;
+			if(job.packedInput) {
+				if(unpackedInput != in) {
+					unpack_chunk_input(gf, unpacked, (const uint8_t*)job.packedInput + offset*job.packSize, procSize, job.packSize, in);
+					unpackedInput = in;
+				}
+				src = unpacked;
+			} else
+				src = ((const uint8_t*)job.inputs[in]) + offset;
+			uint16_t inputConst = gfmat_coeff(job.coeffs->iNums[in], 1);
+			if(exponent == 0) {
+				// the first output is just the input; the rest are powers of it
+				if(store) memcpy(dst[0], src, procSize);
+				else gf->add_multi(1, 0, dst[0], &src, procSize);
+				if(batchOutputs < 2) continue;
+				if(store) gf->pow(batchOutputs-1, 0, dst+1, src, procSize, inputConst, scratch);
+				else gf->pow_add(batchOutputs-1, 0, dst+1, src, procSize, inputConst, scratch);
+			} else {
+				gf->mul(scaled, src, procSize, gfmat_coeff(job.coeffs->iNums[in], exponent-1), scratch);
+				if(store) gf->pow(batchOutputs, 0, dst, scaled, procSize, inputConst, scratch);
+				else gf->pow_add(batchOutputs, 0, dst, scaled, procSize, inputConst, scratch);
+			}
+		}
+	}
+}
+
+// whether multiply_mat_pow_item should be used for a job
+// the scalar lookup method's pow_add isn't used, as it does the same number of lookups per output as multiplying separately
+static bool use_pow_schedule(const ppgf_engine* engine, unsigned int numInputs, const uint_fast16_t* oNums, unsigned int numOutputs) {
+	if(!engine->gf->hasPow() || numInputs > POW_MAX_INPUTS || numOutputs < numInputs * POW_MIN_OUTPUT_RATIO)
+		return false;
+	for(unsigned out = 1; out < numOutputs; out++)
+		if(oNums[out] != oNums[0] + out) return false;
+	return true;
+}
+// allocates the buffers needed by multiply_mat_pow_item for all threads, so that items don't need to allocate any memory
+// returns false if allocation fails, in which case the job should fall back to the regular (output-major) schedule
+static bool alloc_pow_buffers(struct mat_job* job) {
+	job->powBufferSize = CEIL_DIV(job->sched.chunkSize, CACHELINE_SIZE) * CACHELINE_SIZE;
+	ALIGN_ALLOC(job->powBuffers, job->powBufferSize * (job->packedInput ? 2 : 1) * maxNumThreads, CACHELINE_SIZE);
+	return job->powBuffers != NULL;
+}
 
 // performs multiple multiplies for a region, using threads
 // note that inputs will get trashed
@@ -63,67 +549,309 @@ void ppgf_maybe_setup_gf() {
    - len must be a multiple of stride
    - input and length of each output is the same and == len
    - number of outputs and scales is same and == numOutputs
+   - if done is non-NULL, this returns immediately and done is called (from a worker thread) upon completion; all arrays must remain valid until then
 */
-void ppgf_multiply_mat(const void* const* inputs, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add) {
-	// pre-calc all coefficients
-	// calculation does lookups, so faster to do it first and avoid memory penalties later on
-	uint16_t* factors = new uint16_t[numInputs * numOutputs];
-	for(unsigned out=0; out<numOutputs; out++)
-		for(unsigned inp=0; inp<numInputs; inp++) {
-			factors[inp + out*numInputs] = gfmat_coeff(iNums[inp], oNums[out]);
-		}
-	
-	
-	// break the slice into smaller chunks so that we maximise CPU cache usage
-	int numChunks = ROUND_DIV(len, gf->info().idealChunkSize);
-	if(numChunks < 1) numChunks = 1;
-	size_t chunkSize = gf->alignToStride(CEIL_DIV(len, numChunks)); // we'll assume that input chunks are memory aligned here
+void ppgf_multiply_mat(ppgf_engine* engine, const void* const* inputs, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add, ppgf_done_callback done, void* doneArg) {
+	coeff_matrix* coeffs = get_coeff_matrix(engine, iNums, numInputs, numInputs, oNums, numOutputs);
 	
-	// fix up numChunks with actual number (since it may have changed from above)
-	numChunks = CEIL_DIV(len, chunkSize);
+	struct mat_job* job = new struct mat_job;
+	job->engine = engine;
+	job->inputs = inputs;
+	job->packedInput = NULL;
+	job->numInputs = numInputs;
+	job->len = len;
+	job->outputs = outputs;
+	job->numOutputs = numOutputs;
+	job->add = add;
+	job->coeffs = coeffs;
+	job->factors = coeffs->factors;
+	job->packSize = 0;
+	job->powBuffers = NULL;
+	job->done = done;
+	job->doneArg = doneArg;
+	get_tile_schedule(engine, &job->sched, len, numInputs, numOutputs);
 	
 	// avoid nested loop issues by combining chunk & output loop into one
 	// the loop goes through outputs before chunks
-	int loop = 0;
-	#pragma omp parallel for num_threads(maxNumThreads)
-	for(loop = 0; loop < (int)(numOutputs * numChunks); loop++) {
-		size_t offset = (loop / numOutputs) * chunkSize;
-		unsigned int out = loop % numOutputs;
-		int procSize = MIN(len-offset, chunkSize);
-#ifdef _OPENMP
-		int threadNum = omp_get_thread_num();
-#else
-		const int threadNum = 0;
-#endif
+	// unpacked jobs don't use expanded factors (see coeff_matrix)
+	if(use_pow_schedule(engine, numInputs, oNums, numOutputs) && alloc_pow_buffers(job))
+		submit_mat_job(job, &multiply_mat_pow_item, false);
+	else
+		submit_mat_job(job, &multiply_mat_item, false);
+}
 
-		if(!add) memset(((uint8_t*)outputs[out])+offset, 0, procSize);
-		gf->mul_add_multi(numInputs, offset, outputs[out], inputs, procSize, factors + out*numInputs, gfScratch[threadNum]);
+static void multiply_mat_packed_item(void* arg, unsigned loop, unsigned threadNum) {
+	const struct mat_job& job = *(const struct mat_job*)arg;
+	const struct tile_schedule& sched = job.sched;
+	Galois16Mul* gf = job.engine->gf;
+	const Galois16MethodInfo& info = gf->info();
+	const size_t chunkSize = sched.chunkSize;
+	unsigned int chunk = loop / sched.numOutGroups;
+	unsigned int outStart = (loop % sched.numOutGroups) * sched.outGroupSize;
+	unsigned int outEnd = MIN(outStart + sched.outGroupSize, job.numOutputs);
+	size_t offset = chunk * chunkSize;
+	int procSize = MIN(job.len-offset, chunkSize);
+	const uint8_t* src = (const uint8_t*)job.packedInput + offset*job.packSize;
+	const bool canAddPacked = gf->hasMultiAddPacked();
+	
+	// locate the first output and input tile for the next item, which this thread will likely process next
+	const uint8_t* nextItemOut = NULL;
+	const uint8_t* nextItemSrc = NULL;
+	if(loop+1 < sched.numItems) {
+		unsigned int nextChunk = (loop+1) / sched.numOutGroups;
+		nextItemOut = (uint8_t*)job.outputs[((loop+1) % sched.numOutGroups) * sched.outGroupSize] + nextChunk * chunkSize;
+		if(nextChunk != chunk || sched.tileInputs < job.numInputs)
+			nextItemSrc = (const uint8_t*)job.packedInput + nextChunk * chunkSize * job.packSize;
+	}
+	
+	for(unsigned tile = 0; tile < job.numInputs; tile += sched.tileInputs) {
+		unsigned tileInputs = MIN(sched.tileInputs, job.numInputs - tile);
+		const uint8_t* tileSrc = src + tile*procSize;
+		bool lastTile = tile + tileInputs >= job.numInputs;
+		// rows of 1s can only be XORed if the tile doesn't include padding regions, which hold no valid data
+		bool unitTile = canAddPacked && tile + tileInputs <= job.coeffs->iNums.size();
+		
+		// the kernel prefetches the output for the next call, then uses any spare rounds to prefetch inputs
+		// we use those rounds to pull in the next tile, spread across the last few outputs of the current tile
+		const uint8_t* nextSrc = lastTile ? nextItemSrc : tileSrc + tileInputs*procSize;
+		size_t pfInLen = 0;
+		unsigned pfInRounds = 0;
+		if(nextSrc) {
+			unsigned pfOutRounds = 1 << info.prefetchDownscale;
+			unsigned calls = tileInputs / info.idealInputMultiple;
+			if(calls > pfOutRounds) {
+				unsigned nextInputs = lastTile ? sched.tileInputs : MIN(sched.tileInputs, job.numInputs - tile - tileInputs);
+				pfInLen = (calls - pfOutRounds) * (procSize >> info.prefetchDownscale);
+				pfInRounds = CEIL_DIV(chunkSize * nextInputs, pfInLen);
+				if(pfInRounds > outEnd - outStart) pfInRounds = outEnd - outStart;
+			}
+		}
+		
+		for(unsigned out = outStart; out < outEnd; out++) {
+			uint8_t* dst = (uint8_t*)job.outputs[out] + offset;
+			
+			// prefetch what the next iteration will operate on
+			const void* pfOut = dst;
+			const void* pfIn = NULL;
+			if(out+1 < outEnd)
+				pfOut = (uint8_t*)job.outputs[out+1] + offset;
+			else if(!lastTile)
+				pfOut = (uint8_t*)job.outputs[outStart] + offset;
+			else if(nextItemOut)
+				pfOut = nextItemOut;
+			if(pfInRounds && out >= outEnd - pfInRounds)
+				pfIn = nextSrc + (out - (outEnd - pfInRounds)) * pfInLen;
+			
+			// the first tile overwrites the output, unless adding to it
+			const bool store = !job.add && !tile;
+			if(unitTile && job.coeffs->unitRows[out]) {
+				if(store)
+					gf->add_multi_packed_store(tileInputs, dst, tileSrc, procSize);
+				else
+					gf->add_multi_packed(tileInputs, dst, tileSrc, procSize);
+			} else if(job.expanded) {
+				const uint8_t* expCoeffs = (const uint8_t*)job.expanded + (out*job.numInputs + tile) * info.expandedCoeffSize;
+				if(store)
+					gf->mul_multi_packpf_exp(tileInputs, dst, tileSrc, procSize, expCoeffs, job.engine->scratch[threadNum], pfIn, pfOut);
+				else
+					gf->mul_add_multi_packpf_exp(tileInputs, dst, tileSrc, procSize, expCoeffs, job.engine->scratch[threadNum], pfIn, pfOut);
+			} else {
+				const uint16_t* factors = job.factors + out*job.numInputs + tile;
+				if(store)
+					gf->mul_multi_packpf(tileInputs, dst, tileSrc, procSize, factors, job.engine->scratch[threadNum], pfIn, pfOut);
+				else
+					gf->mul_add_multi_packpf(tileInputs, dst, tileSrc, procSize, factors, job.engine->scratch[threadNum], pfIn, pfOut);
+			}
+		}
 	}
+}
+
+// as above, but inputs are taken from a packed buffer, prepared via ppgf_prep_input_packed
+// the buffer holds packSize inputs of len bytes, arranged chunk-major so that all inputs needed for a chunk are contiguous in memory
+// numInputs can be less than packSize; unused input slots are skipped where possible, otherwise multiplied by 0
+/* REQUIRES:
+   - input and each pointer in outputs must be aligned
+   - len must be a multiple of stride, and the same as that given to ppgf_prep_input_packed
+   - numInputs <= packSize
+*/
+void ppgf_multiply_mat_packed(ppgf_engine* engine, const void* input, unsigned int packSize, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add, ppgf_done_callback done, void* doneArg) {
+	// inputs are packed in groups of idealInputMultiple, so we can only drop whole groups from the end
+	const Galois16MethodInfo& info = engine->gf->info();
+	unsigned int regions = CEIL_DIV(numInputs, info.idealInputMultiple) * info.idealInputMultiple;
+	if(regions > packSize) regions = packSize;
 	
-	delete[] factors;
+	coeff_matrix* coeffs = get_coeff_matrix(engine, iNums, numInputs, regions, oNums, numOutputs);
+	
+	struct mat_job* job = new struct mat_job;
+	job->engine = engine;
+	job->inputs = NULL;
+	job->packedInput = input;
+	job->numInputs = regions;
+	job->len = len;
+	job->outputs = outputs;
+	job->numOutputs = numOutputs;
+	job->add = add;
+	job->coeffs = coeffs;
+	job->factors = coeffs->factors;
+	job->packSize = packSize;
+	job->powBuffers = NULL;
+	job->done = done;
+	job->doneArg = doneArg;
+	get_tile_schedule(engine, &job->sched, len, regions, numOutputs);
+	if(use_pow_schedule(engine, numInputs, oNums, numOutputs) && alloc_pow_buffers(job))
+		submit_mat_job(job, &multiply_mat_pow_item, false);
+	else
+		submit_mat_job(job, &multiply_mat_packed_item, engine->gf->hasExpandedCoefficients());
 }
 
+void ppgf_set_tiling(int enable) {
+	useTiling = !!enable;
+}
 
-void ppgf_prep_input(size_t destLen, size_t inputLen, char* dest, char* src) {
-	ppgf_maybe_setup_gf();
+// sizes/shares receive the L1D, L2 and L3 values (0 if unknown); chunkSize is that used for a slice of sliceLen
+void ppgf_get_cache_info(const ppgf_engine* engine, size_t* sizes, unsigned int* shares, size_t* chunkSize, size_t* tileSize, size_t sliceLen) {
+	const Galois16CacheInfo& cache = Galois16Mul::cacheInfo();
+	sizes[0] = cache.sizeL1D;
+	sizes[1] = cache.sizeL2;
+	sizes[2] = cache.sizeL3;
+	shares[0] = cache.sharesL1D;
+	shares[1] = cache.sharesL2;
+	shares[2] = cache.sharesL3;
+	*chunkSize = get_chunk_size(engine, engine->gf->alignToStride(sliceLen ? sliceLen : 1));
+	*tileSize = tileCacheSize;
+}
+
+void ppgf_prep_input(const ppgf_engine* engine, size_t destLen, size_t inputLen, char* dest, char* src) {
 	if(inputLen < destLen) {
 		// need to zero out empty space at end (for final block)
 		memset(dest + inputLen, 0, destLen - inputLen);
 	}
-	gf->prepare(dest, src, inputLen);
+	engine->gf->prepare(dest, src, inputLen);
+}
+// prepares an input into slot inputNum of a packed buffer, for use with ppgf_multiply_mat_packed
+// sliceLen must be a multiple of stride; if inputLen < sliceLen, the remainder is zero filled
+void ppgf_prep_input_packed(const ppgf_engine* engine, size_t sliceLen, size_t inputLen, char* dest, const char* src, unsigned int inputNum, unsigned int packSize) {
+	engine->gf->prepare_packed(dest, src, inputLen, sliceLen, packSize, inputNum, get_chunk_size(engine, sliceLen));
 }
-void ppgf_finish_input(unsigned int numInputs, uint16_t** inputs, size_t len) {
-	ppgf_maybe_setup_gf();
-	if(gf->needPrepare()) {
-		// TODO: multi-thread this?
-		for(int in = 0; in < (int)numInputs; in++)
-			gf->finish(inputs[in], len);
+// as above, but prepares the input in blocks of whole chunks, calling visit on each block of source data just before it's prepared
+// this allows the caller to process (e.g. hash) the input whilst it's in cache, rather than making a separate pass over it
+void ppgf_prep_input_packed_visit(const ppgf_engine* engine, size_t sliceLen, size_t inputLen, char* dest, const char* src, unsigned int inputNum, unsigned int packSize, ppgf_input_visitor visit, void* visitArg) {
+	size_t chunkLen = get_chunk_size(engine, sliceLen);
+	// target blocks of around L1 size; chunks are usually about this size already
+	size_t l1Size = Galois16Mul::cacheInfo().sizeL1D;
+	if(!l1Size) l1Size = 32768;
+	size_t blockLen = chunkLen * CEIL_DIV(l1Size, chunkLen);
+	
+	// a block of whole chunks, prepared as if it were a complete slice, has the same layout as that part of the full slice
+	size_t pos = 0;
+	while(inputLen - pos > blockLen) {
+		visit(visitArg, src + pos, blockLen);
+		engine->gf->prepare_packed(dest + (pos/chunkLen) * chunkLen * packSize, src + pos, blockLen, blockLen, packSize, inputNum, chunkLen);
+		pos += blockLen;
+	}
+	// the final block handles the uneven last chunk and zero fills the remainder of the slice
+	// chunkLen must not exceed the (remaining) slice length; if only the last chunk remains, it is the chunk length
+	if(inputLen > pos)
+		visit(visitArg, src + pos, inputLen - pos);
+	size_t remaining = sliceLen - pos;
+	engine->gf->prepare_packed(dest + (pos/chunkLen) * chunkLen * packSize, src + pos, inputLen - pos, remaining, packSize, inputNum, remaining < chunkLen ? remaining : chunkLen);
+}
+struct finish_job {
+	const Galois16Mul* gf;
+	uint16_t** inputs;
+	size_t len;
+	ppgf_done_callback done;
+	void* doneArg;
+};
+static void finish_input_item(void* arg, unsigned in, unsigned) {
+	const struct finish_job& job = *(const struct finish_job*)arg;
+	job.gf->finish(job.inputs[in], job.len);
+}
+static void finish_job_done(void* arg) {
+	struct finish_job* job = (struct finish_job*)arg;
+	ppgf_done_callback done = job->done;
+	void* doneArg = job->doneArg;
+	delete job;
+	done(doneArg);
+}
+// converts inputs back to their regular form, with each input processed as a separate item across threads
+// if done is non-NULL, this returns immediately and done is called upon completion (possibly before this returns, if there's nothing to do)
+void ppgf_finish_input(const ppgf_engine* engine, unsigned int numInputs, uint16_t** inputs, size_t len, ppgf_done_callback done, void* doneArg) {
+	if(!engine->gf->needPrepare()) {
+		if(done) done(doneArg);
+		return;
+	}
+	if(done) {
+		struct finish_job* job = new struct finish_job;
+		job->gf = engine->gf;
+		job->inputs = inputs;
+		job->len = len;
+		job->done = done;
+		job->doneArg = doneArg;
+		pool->submit(numInputs, &finish_input_item, job, &finish_job_done, job);
+	} else {
+		struct finish_job job = {engine->gf, inputs, len, NULL, NULL};
+		pool->run(numInputs, &finish_input_item, &job);
 	}
 }
 
-void ppgf_get_method(int* rMethod, const char** rMethLong, int* align, int* stride) {
-	ppgf_maybe_setup_gf();
-	const Galois16MethodInfo& info = gf->info();
+// untransforms a single region of an input, for callers which need to process the result whilst still in cache
+// the region must be aligned, and len a multiple of stride
+void ppgf_finish_partial(const ppgf_engine* engine, void* data, size_t len) {
+	engine->gf->finish(data, len);
+}
+// block size for use with ppgf_finish_partial, such that a block from each of numInputs inputs fits comfortably in L1 cache
+// the result is a multiple of stride and multiple (which must be a power of 2)
+size_t ppgf_get_finish_block_size(const ppgf_engine* engine, unsigned int numInputs, size_t multiple) {
+	const Galois16CacheInfo& cache = Galois16Mul::cacheInfo();
+	size_t block = (cache.sizeL1D ? cache.sizeL1D : 32768) / 2 / (numInputs ? numInputs : 1);
+	size_t align = engine->gf->info().stride; // always a power of 2
+	if(multiple > align) align = multiple;
+	block -= block % align;
+	if(block < align) block = align;
+	return block;
+}
+
+// runs func over numItems items using the thread pool, for tasks outside of GF computation (such as hashing)
+void ppgf_parallel_run(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg) {
+	pool->run(numItems, func, arg);
+}
+// as above, but returns immediately; done is called from a worker thread once all items are complete
+void ppgf_parallel_submit(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg, ppgf_done_callback done, void* doneArg) {
+	pool->submit(numItems, func, arg, done, doneArg);
+}
+// as ppgf_parallel_submit, but runs on the hashing pool
+void ppgf_hash_submit(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg, ppgf_done_callback done, void* doneArg) {
+	hashPool->submit(numItems, func, arg, done, doneArg);
+}
+
+// fills methods with the IDs of methods supported by the CPU; returns the number of methods available
+unsigned int ppgf_get_available_methods(int* methods, unsigned int maxMethods) {
+	std::vector<Galois16Methods> available = Galois16Mul::availableMethods(true);
+	unsigned int num = MIN((unsigned int)available.size(), maxMethods);
+	for(unsigned int i=0; i<num; i++)
+		methods[i] = (int)available[i];
+	return num;
+}
+int ppgf_get_num_methods() {
+	return (int)GF16_NUM_METHODS;
+}
+// fills methods with the IDs of XOR-JIT methods, which accept a JIT optimisation strategy; returns the number of IDs written
+unsigned int ppgf_get_xor_jit_methods(int* methods, unsigned int maxMethods) {
+	static const Galois16Methods jitMethods[] = {
+		GF16_XOR_JIT_SSE2, GF16_XOR_JIT_AVX, GF16_XOR_JIT_AVX2, GF16_XOR_JIT_AVX512
+	};
+	unsigned int num = MIN((unsigned int)(sizeof(jitMethods) / sizeof(*jitMethods)), maxMethods);
+	for(unsigned int i=0; i<num; i++)
+		methods[i] = (int)jitMethods[i];
+	return num;
+}
+const char* ppgf_get_cpu_signature() {
+	return Galois16Mul::cpuSignature();
+}
+
+void ppgf_get_method(const ppgf_engine* engine, int* rMethod, const char** rMethLong, int* align, int* stride) {
+	const Galois16MethodInfo& info = engine->gf->info();
 	*rMethod = info.id;
 	*rMethLong = info.name;
 	*align = info.alignment;
@@ -131,32 +859,32 @@ void ppgf_get_method(int* rMethod, const char** rMethLong, int* align, int* stri
 }
 
 int ppgf_get_num_threads() {
-#ifdef _OPENMP
 	return maxNumThreads;
-#else
-	return 1;
-#endif
 }
 void ppgf_set_num_threads(int threads) {
-#ifdef _OPENMP
 	maxNumThreads = threads;
 	if(maxNumThreads < 1) maxNumThreads = defaultNumThreads;
-	if(gf && (unsigned)maxNumThreads > gfScratch.size()) {
-		gfScratch.reserve(maxNumThreads);
-		for(unsigned i=gfScratch.size(); i<(unsigned)maxNumThreads; i++)
-			gfScratch.push_back(gf->mutScratch_alloc());
-	}
-#endif
+	// waits for any jobs in flight; engines extend their scratch on their next job
+	pool->setNumThreads(maxNumThreads);
+	hashPool->setNumThreads(maxNumThreads);
+	update_tile_size();
 }
 void ppgf_init_gf_module() {
-#ifdef _OPENMP
-	maxNumThreads = omp_get_num_procs();
-	if(maxNumThreads < 1) maxNumThreads = 1;
+	maxNumThreads = (int)ThreadPool::hardwareThreads();
 	defaultNumThreads = maxNumThreads;
-#endif
+	// the pool is never destroyed, as its threads may still be running whilst the process exits
+	pool = new ThreadPool(maxNumThreads);
+	hashPool = new ThreadPool(maxNumThreads); // workers are only started if hashing is submitted to it
+	update_tile_size();
 }
 
-int ppgf_set_method(int meth, int size_hint) {
-	setup_gf((Galois16Methods)meth, size_hint);
+// chunkSize and jitOptStrat override the method's defaults, if non-zero/non-negative respectively
+// the engine must not have any jobs in flight
+int ppgf_set_method(ppgf_engine* engine, int meth, int size_hint, size_t chunkSize, int jitOptStrat) {
+	if(meth < GF16_AUTO || meth >= (int)GF16_NUM_METHODS)
+		return 1;
+	if(size_hint < 0) size_hint = 0;
+	engine->chunkSizeOverride = chunkSize;
+	setup_gf(engine, (Galois16Methods)meth, size_hint, jitOptStrat);
 	return 0;
 }
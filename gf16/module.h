@@ -1,16 +1,38 @@
 #include "../src/stdint.h"
 
+// an engine holds a GF method along with its per-thread state; engines are independent of each other, so can be used concurrently
+// all engines share the same pool of threads, so the thread count and tiling settings apply to all of them
+typedef struct ppgf_engine ppgf_engine;
+// called from a worker thread once an asynchronous job is complete
+typedef void(*ppgf_done_callback)(void* arg);
+
 void ppgf_init_gf_module();
 void ppgf_init_constants();
 
-void ppgf_omp_check_num_threads();
-void ppgf_multiply_mat(const void* const* inputs, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add);
+ppgf_engine* ppgf_engine_create();
+void ppgf_engine_destroy(ppgf_engine* engine);
+
+void ppgf_multiply_mat(ppgf_engine* engine, const void* const* inputs, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add, ppgf_done_callback done, void* doneArg);
+void ppgf_multiply_mat_packed(ppgf_engine* engine, const void* input, unsigned int packSize, uint_fast16_t* iNums, unsigned int numInputs, size_t len, void** outputs, uint_fast16_t* oNums, unsigned int numOutputs, int add, ppgf_done_callback done, void* doneArg);
 
-void ppgf_prep_input(size_t destLen, size_t inputLen, char* dest, char* src);
-void ppgf_finish_input(unsigned int numInputs, uint16_t** inputs, size_t len);
-void ppgf_get_method(int* rMethod, const char** rMethLong, int* align, int* stride);
-int ppgf_set_method(int meth, int size_hint);
+void ppgf_prep_input(const ppgf_engine* engine, size_t destLen, size_t inputLen, char* dest, char* src);
+void ppgf_prep_input_packed(const ppgf_engine* engine, size_t sliceLen, size_t inputLen, char* dest, const char* src, unsigned int inputNum, unsigned int packSize);
+typedef void(*ppgf_input_visitor)(void* arg, const void* data, size_t len);
+void ppgf_prep_input_packed_visit(const ppgf_engine* engine, size_t sliceLen, size_t inputLen, char* dest, const char* src, unsigned int inputNum, unsigned int packSize, ppgf_input_visitor visit, void* visitArg);
+void ppgf_finish_input(const ppgf_engine* engine, unsigned int numInputs, uint16_t** inputs, size_t len, ppgf_done_callback done, void* doneArg);
+void ppgf_finish_partial(const ppgf_engine* engine, void* data, size_t len);
+size_t ppgf_get_finish_block_size(const ppgf_engine* engine, unsigned int numInputs, size_t multiple);
+void ppgf_parallel_run(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg);
+void ppgf_parallel_submit(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg, ppgf_done_callback done, void* doneArg);
+void ppgf_hash_submit(unsigned int numItems, void(*func)(void*, unsigned int, unsigned int), void* arg, ppgf_done_callback done, void* doneArg);
+void ppgf_get_method(const ppgf_engine* engine, int* rMethod, const char** rMethLong, int* align, int* stride);
+int ppgf_set_method(ppgf_engine* engine, int meth, int size_hint, size_t chunkSize, int jitOptStrat);
+unsigned int ppgf_get_available_methods(int* methods, unsigned int maxMethods);
+int ppgf_get_num_methods();
+unsigned int ppgf_get_xor_jit_methods(int* methods, unsigned int maxMethods);
+const char* ppgf_get_cpu_signature();
+void ppgf_set_tiling(int enable);
+void ppgf_get_cache_info(const ppgf_engine* engine, size_t* sizes, unsigned int* shares, size_t* chunkSize, size_t* tileSize, size_t sliceLen);
 
-void ppgf_maybe_setup_gf();
 int ppgf_get_num_threads();
 void ppgf_set_num_threads(int threads);
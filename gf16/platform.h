@@ -71,6 +71,12 @@
 #if defined(__SSE2__) && _MSC_VER >= 1920
 	#define __GFNI__ 1
 #endif
+#if defined(__SSE2__) && !defined(__PCLMUL__)
+	#define __PCLMUL__ 1
+#endif
+#if defined(__AVX512F__) && _MSC_VER >= 1920
+	#define __VPCLMULQDQ__ 1
+#endif
 
 #endif /* _MSC_VER */
 
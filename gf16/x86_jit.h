@@ -383,6 +383,28 @@ static inline size_t _jit_vmovdqa_store(uint8_t* jit, uint_fast8_t mreg, int32_t
 	return p;
 }
 
+/** AVX (128-bit) VEX coded instructions; same as the 256-bit forms, with VEX.L cleared **/
+static inline size_t _jit_vex_l0(uint8_t* jit, size_t len) {
+	/* L is bit 2 of the last VEX prefix byte, which is the 2nd byte for the 2-byte (C5) form, or 3rd byte for the 3-byte (C4) form */
+	jit[jit[0] == 0xC5 ? 1 : 2] &= ~4;
+	return len;
+}
+static inline size_t _jit_vpxor128_m(uint8_t* jit, uint_fast8_t xregD, uint_fast8_t xreg1, uint_fast8_t mreg, int32_t offs) {
+	return _jit_vex_l0(jit, _jit_vpxor_m(jit, xregD, xreg1, mreg, offs));
+}
+static inline size_t _jit_vpxor128_r(uint8_t* jit, uint_fast8_t xregD, uint_fast8_t xreg1, uint_fast8_t xreg2) {
+	return _jit_vex_l0(jit, _jit_vpxor_r(jit, xregD, xreg1, xreg2));
+}
+static inline size_t _jit_vmovdqa128(uint8_t* jit, uint_fast8_t xreg, uint_fast8_t xreg2) {
+	return _jit_vex_l0(jit, _jit_vmovdqa(jit, xreg, xreg2));
+}
+static inline size_t _jit_vmovdqa128_load(uint8_t* jit, uint_fast8_t xreg, uint_fast8_t mreg, int32_t offs) {
+	return _jit_vex_l0(jit, _jit_vmovdqa_load(jit, xreg, mreg, offs));
+}
+static inline size_t _jit_vmovdqa128_store(uint8_t* jit, uint_fast8_t mreg, int32_t offs, uint_fast8_t xreg) {
+	return _jit_vex_l0(jit, _jit_vmovdqa_store(jit, mreg, offs, xreg));
+}
+
 /** AVX3 (512-bit) EVEX coded instructions **/
 static inline size_t _jit_vpxord_m(uint8_t* jit, uint_fast8_t zregD, uint_fast8_t zreg1, uint_fast8_t mreg, int32_t offs) {
 	int offsFlag = (offs != 0 || mreg == 13) << (int)(((offs+128*64) & ~0x3FC0) != 0);
@@ -0,0 +1,140 @@
+"use strict";
+
+// Empirical selection of the GF method and its parameters, by benchmarking candidates on this host
+// Results are saved to a profile, keyed by CPU signature, which later runs pick up
+
+var gf = require('../build/Release/parpar_gf.node');
+var fs = require('fs');
+var path = require('path');
+var os = require('os');
+var crypto = require('crypto');
+
+var allocBuffer = (Buffer.allocUnsafe || Buffer);
+
+var XOR_JIT_METHODS = gf.xor_jit_methods(); // GF16_XOR_JIT_*
+var JIT_STRATEGIES = [0, 1, 2, 3]; // GF16_XOR_JIT_STRAT_*
+var CHUNK_SCALES = [0.25, 0.5, 2, 4]; // relative to the method's default chunk size
+var NUM_FINALISTS = 3; // number of best candidates to sweep chunk sizes for
+
+// limits on the amount of work done per trial, so that tuning completes in reasonable time
+var MAX_TRIAL_INPUT = 64*1048576;
+var MAX_TRIAL_OUTPUTS = 32;
+var MIN_TRIAL_TIME = 0.1; // seconds
+
+var alignedBuffer = function(engine, len, alignment) {
+	var buf = allocBuffer(len + alignment);
+	var ao = engine.alignment_offset(buf);
+	if(ao) ao = alignment - ao;
+	return buf.slice(ao, ao + len);
+};
+var hrtimeToSecs = function(t) {
+	return t[0] + t[1]/1e9;
+};
+
+// measures throughput (input bytes processed per second) of a single configuration
+// if the warm up run is much slower than bestSpeed, the configuration is not measured any further
+var runTrial = function(engine, data, numInputs, numOutputs, method, chunkSize, jitStrat, bestSpeed) {
+	var sliceSize = data.length;
+	var info = engine.set_method(method, sliceSize, chunkSize, jitStrat);
+	if(info.method != method) return null; // method got substituted, so not available
+	var len = Math.ceil(sliceSize / info.stride) * info.stride;
+	
+	var input = alignedBuffer(engine, len * numInputs, info.alignment);
+	var iNums = [];
+	for(var i=0; i<numInputs; i++) {
+		engine.copy_packed(data, input, len, i, numInputs);
+		iNums.push(i);
+	}
+	var outputs = [], oNums = [];
+	for(var i=0; i<numOutputs; i++) {
+		outputs.push(alignedBuffer(engine, len, info.alignment));
+		oNums.push(i);
+	}
+	
+	var result = {
+		method: method,
+		chunk_size: info.chunk_size,
+		jit_strat: jitStrat
+	};
+	
+	// warm up, then run until enough time has elapsed to be reasonably accurate
+	var start = process.hrtime();
+	engine.generate_packed(input, len, numInputs, iNums, outputs, oNums, false);
+	result.speed = sliceSize * numInputs / hrtimeToSecs(process.hrtime(start));
+	if(result.speed < bestSpeed/2) return result;
+	
+	var rounds = 0, time = 0;
+	start = process.hrtime();
+	do {
+		engine.generate_packed(input, len, numInputs, iNums, outputs, oNums, false);
+		rounds++;
+		time = hrtimeToSecs(process.hrtime(start));
+	} while(time < MIN_TRIAL_TIME || rounds < 2);
+	result.speed = sliceSize * numInputs * rounds / time;
+	return result;
+};
+
+module.exports = {
+	// benchmarks all methods available on the CPU, with a processing batch of numInputs slices of sliceSize bytes, generating numOutputs recovery slices
+	// returns the list of candidates tried, fastest first; trials are run on a separate GF engine, so the module's method is left unchanged
+	tune: function(sliceSize, numInputs, numOutputs) {
+		var engine = new gf.Engine();
+		sliceSize = Math.max(sliceSize|0, 2);
+		numInputs = Math.max(Math.min(numInputs|0, Math.floor(MAX_TRIAL_INPUT / sliceSize)), 1);
+		numOutputs = Math.max(Math.min(numOutputs|0, MAX_TRIAL_OUTPUTS), 1);
+		var data = crypto.pseudoRandomBytes(sliceSize);
+		
+		var results = [];
+		var bestSpeed = 0;
+		var addResult = function(r) {
+			if(!r) return;
+			results.push(r);
+			bestSpeed = Math.max(bestSpeed, r.speed);
+		};
+		// first round: every method, at its default chunk size
+		gf.available_methods().forEach(function(method) {
+			if(XOR_JIT_METHODS.indexOf(method) >= 0) {
+				JIT_STRATEGIES.forEach(function(strat) {
+					addResult(runTrial(engine, data, numInputs, numOutputs, method, 0, strat, bestSpeed));
+				});
+			} else
+				addResult(runTrial(engine, data, numInputs, numOutputs, method, 0, -1, bestSpeed));
+		});
+		results.sort(function(a, b) { return b.speed - a.speed; });
+		
+		// second round: sweep chunk sizes for the best candidates
+		results.slice(0, NUM_FINALISTS).forEach(function(r) {
+			CHUNK_SCALES.forEach(function(scale) {
+				var chunkSize = Math.round(r.chunk_size * scale);
+				if(chunkSize < 4096 || chunkSize > sliceSize) return;
+				addResult(runTrial(engine, data, numInputs, numOutputs, r.method, chunkSize, r.jit_strat, bestSpeed));
+			});
+		});
+		results.sort(function(a, b) { return b.speed - a.speed; });
+		return results;
+	},
+	
+	profilePath: (function() {
+		var home = os.homedir ? os.homedir() : (process.env.HOME || process.env.USERPROFILE);
+		return process.env.PARPAR_TUNE_PROFILE || (home ? path.join(home, '.parpar_tune.json') : null);
+	})(),
+	// returns the saved tuning result for this CPU, or null if there isn't one
+	loadProfile: function() {
+		if(!this.profilePath) return null;
+		try {
+			var profiles = JSON.parse(fs.readFileSync(this.profilePath, 'utf8'));
+			return profiles[gf.cpu_signature()] || null;
+		} catch(x) {
+			return null; // missing or invalid profile
+		}
+	},
+	saveProfile: function(entry) {
+		if(!this.profilePath) throw new Error('Unable to determine location for tuning profile');
+		var profiles = {};
+		try {
+			profiles = JSON.parse(fs.readFileSync(this.profilePath, 'utf8'));
+		} catch(x) {}
+		profiles[gf.cpu_signature()] = entry;
+		fs.writeFileSync(this.profilePath, JSON.stringify(profiles, null, '\t'));
+	}
+};
@@ -2,10 +2,11 @@
 
 var crypto = require('crypto');
 var gf = require('../build/Release/parpar_gf.node');
-var y = require('yencode');
 var Queue = require('./queue');
+var gftune = require('./gftune');
 
-var gfMethod = gf.set_method();
+var gfMethod; // set once GF_METHODS is defined
+var gfMethodArgs; // arguments to set_method for the current method, used to configure GF engines
 var allocBuffer = (Buffer.allocUnsafe || Buffer);
 var toBuffer = (Buffer.alloc ? Buffer.from : Buffer);
 
@@ -112,7 +113,81 @@ else {
 	};
 }
 
+// inputs are prepared into packed buffers ("arenas"), each holding a batch of slices laid out so that data required for a chunk is contiguous
+var InputArena = function(engine, numInputs, len) {
+	this.engine = engine;
+	this.buf = alignedBufferArray(1, numInputs * len)[0];
+	this.len = len;
+	this.sliceNums = Array(numInputs);
+	this.count = 0;
+};
+InputArena.prototype = {
+	// slices in a packed buffer are laid out according to slice length, so the buffer can only be re-used for different lengths if it's large enough
+	reset: function(len) {
+		if(len * this.sliceNums.length > this.buf.length)
+			this.buf = alignedBufferArray(1, this.sliceNums.length * len)[0];
+		this.len = len;
+		this.count = 0;
+	},
+	add: function(dataSlice, sliceNum, hash) {
+		if(hash) // hash the data whilst it's being copied in, so that it only needs to be read once
+			hash.done(this.engine.ingest_packed(dataSlice, this.buf, this.len, this.count, this.sliceNums.length, hash.md5[0], hash.md5[1]));
+		else
+			this.engine.copy_packed(dataSlice, this.buf, this.len, this.count, this.sliceNums.length);
+		this.sliceNums[this.count++] = sliceNum;
+		return this.count >= this.sliceNums.length;
+	},
+	generate: function(outputs, outputNums, add, cb) {
+		this.engine.generate_packed(this.buf, this.len, this.sliceNums.length, this.count < this.sliceNums.length ? this.sliceNums.slice(0, this.count) : this.sliceNums, outputs, outputNums, add, cb);
+	}
+};
+
+// MD5 updates (and CRC32 computations) are hashed in batches on the native hashing thread pool; updates queued whilst a batch is in progress form the next batch, so that data from different files (or slices) is hashed in parallel
+var HashQueue = function() {
+	this.md5 = [];
+	this.data = [];
+	this.crcs = [];
+	this.cbs = [];
+	this.busy = false;
+};
+HashQueue.prototype = {
+	// updates each of the MD5 contexts with the corresponding data, then calls cb; updates to a context are applied in the order they're queued
+	// where crcs[i] is a 4 byte Buffer, it receives the CRC32 of data[i]
+	add: function(md5, data, crcs, cb) {
+		for(var i=0; i<md5.length; i++) {
+			this.md5.push(md5[i]);
+			this.data.push(data[i]);
+			this.crcs.push(crcs[i]);
+		}
+		this.cbs.push(cb);
+		if(!this.busy) {
+			this.busy = true;
+			process.nextTick(this._run.bind(this));
+		}
+	},
+	_run: function() {
+		if(!this.cbs.length) {
+			this.busy = false;
+			return;
+		}
+		var cbs = this.cbs;
+		var self = this;
+		gf.md5_update_batch(this.md5, this.data, function() {
+			self._run();
+			cbs.forEach(function(cb) {
+				cb();
+			});
+		}, this.crcs);
+		this.md5 = [];
+		this.data = [];
+		this.crcs = [];
+		this.cbs = [];
+	}
+};
+
+// each instance has its own GF engine, so that multiple instances can be processing concurrently
 var GFWrapper = {
+	_gfEngine: null,
 	bufferInputs: 16,
 	bgProcessInputs: 16,
 	qInputEmpty: null,
@@ -120,15 +195,24 @@ var GFWrapper = {
 	_processStarted: false,
 	qDone: null,
 	bufferedInputs: null,
-	bufferedInSlices: null,
 	bufferedInputPos: 0,
 	_mergeRecovery: false,
+	_processPending: null,
 	
 	// referenced items, already defined by parents
 	//recoveryData: null,
 	//recoverySlices: null,
 	//chunkSize: null,
 	
+	// the engine is created with the method current at the time of first use
+	_engine: function() {
+		if(!this._gfEngine) {
+			this._gfEngine = new gf.Engine();
+			this._gfEngine.set_method.apply(this._gfEngine, gfMethodArgs);
+		}
+		return this._gfEngine;
+	},
+	
 	// do not call this function after processing has started!
 	setInputBufferSize: function(bufferInputs, bgProcessInputs) {
 		this.bufferInputs = Math.min(bufferInputs | 0, 65536);
@@ -137,70 +221,69 @@ var GFWrapper = {
 	},
 	
 	_bgProcess: function(cb) {
-		var processInputs = this.bgProcessInputs;
-		var inputs = Array(processInputs);
-		var blankInputs = 0;
-		for(var i = 0; i < processInputs; i++) {
-			this.qInputReady.take(function(i, input) {
-				if(input)
-					inputs[i] = input;
-				else
-					blankInputs++;
-				
-				if(i == processInputs-1) {
-					var iSlices = Array(processInputs - blankInputs),
-						iNums = Array(processInputs - blankInputs);
-					for(var j = 0; j < iSlices.length; j++) {
-						iNums[j] = inputs[j][0];
-						iSlices[j] = inputs[j][1];
-					}
-					if(iSlices.length) {
-						gf.generate(iSlices, iNums, this.recoveryData, this.recoverySlices, this._mergeRecovery, function() {
-							for(var j = 0; j < iSlices.length; j++)
-								this.qInputEmpty.add(inputs[j]);
-							
-							if(blankInputs)
-								cb();
-							else
-								this._bgProcess(cb);
-						}.bind(this));
-						this._mergeRecovery = true;
-					} else
-						cb();
-				}
-			}.bind(this, i));
+		this.qInputReady.take(function(arena) {
+			if(!arena) return cb();
+			arena.generate(this.recoveryData, this.recoverySlices, this._mergeRecovery, function() {
+				this.qInputEmpty.add(arena);
+				this._bgProcess(cb);
+			}.bind(this));
+			this._mergeRecovery = true;
+		}.bind(this));
+	},
+	// if hash is supplied, the data is also fed through hash.md5 (pair of MD5 contexts), and hash.done is called with its CRC32 before cb
+	// calls made before the previous call's cb (e.g. when reading multiple files at once) are queued, and processed in order
+	bufferedProcess: function(dataSlice, sliceNum, len, cb, hash) {
+		if(this._processPending) {
+			this._processPending.push(arguments);
+			return;
 		}
+		this._processPending = [];
+		var self = this;
+		var run = function(args) {
+			self._bufferedProcess(args[0], args[1], args[2], function() {
+				var next = self._processPending.shift();
+				if(next) run(next);
+				else self._processPending = null;
+				args[3]();
+			}, args[4]);
+		};
+		run(arguments);
 	},
 	// TODO: add way to partially submit blocks (helps with handling very large slice sizes)
-	bufferedProcess: function(dataSlice, sliceNum, len, cb) {
-		if(!len || !dataSlice.length) return process.nextTick(cb);
+	_bufferedProcess: function(dataSlice, sliceNum, len, cb, hash) {
+		if(!len || !dataSlice.length) {
+			if(hash) {
+				gf.md5_update2(hash.md5[0], hash.md5[1], dataSlice);
+				hash.done(gf.crc32(dataSlice));
+			}
+			return process.nextTick(cb);
+		}
 		
 		if(!this.bgProcessInputs) {
 			
 			//this._processStarted = true;
-			if(!this.bufferedInputs) {
-				this.bufferedInputs = alignedBufferArray(this.bufferInputs, len);
-				this.bufferedInSlices = Array(this.bufferInputs);
-				this.bufferedInputPos = 0;
-			}
-			gf.copy(dataSlice, this.bufferedInputs[this.bufferedInputPos]);
-			this.bufferedInSlices[this.bufferedInputPos] = sliceNum;
-			this.bufferedInputPos++;
-			if(this.bufferedInputPos >= this.bufferInputs) {
-				gf.generate(this.bufferedInputs, this.bufferedInSlices, this.recoveryData, this.recoverySlices, this._mergeRecovery, cb);
+			if(!this.bufferedInputs)
+				this.bufferedInputs = new InputArena(this._engine(), this.bufferInputs, len);
+			else if(!this.bufferedInputs.count)
+				this.bufferedInputs.reset(len);
+			if(this.bufferedInputs.add(dataSlice, sliceNum, hash)) {
+				this.bufferedInputs.generate(this.recoveryData, this.recoverySlices, this._mergeRecovery, cb);
 				this._mergeRecovery = true;
-				this.bufferedInputPos = 0;
+				this.bufferedInputs.count = 0;
 			} else
 				process.nextTick(cb);
+			this.bufferedInputPos = this.bufferedInputs.count;
 			
 		} else {
 			
 			if(!this.qInputEmpty) {
 				this.qInputEmpty = new Queue();
 				this.qInputReady = new Queue();
-				alignedBufferArray(this.bufferInputs + this.bgProcessInputs, len).forEach(function(buf) {
-					this.qInputEmpty.add([0, buf]);
-				}.bind(this));
+				// allow one batch to be processed whilst the remaining buffer is being filled
+				var numArenas = Math.ceil(this.bufferInputs / this.bgProcessInputs) + 1;
+				for(var i = 0; i < numArenas; i++)
+					this.qInputEmpty.add(new InputArena(this._engine(), this.bgProcessInputs, len));
+				this.bufferedInputs = null; // the arena currently being filled
 				this.bufferedInputPos = 0; // this is just used as a counter
 			}
 			if(!this._processStarted) {
@@ -209,12 +292,21 @@ var GFWrapper = {
 				}.bind(this));
 				this._processStarted = true;
 			}
-			this.qInputEmpty.take(function(input) {
-				input[0] = sliceNum;
-				gf.copy(dataSlice, input[1]);
-				this.qInputReady.add(input);
+			var addInput = function(arena) {
+				if(!this.bufferedInputs) {
+					arena.reset(len);
+					this.bufferedInputs = arena;
+				}
+				if(this.bufferedInputs.add(dataSlice, sliceNum, hash)) {
+					this.qInputReady.add(this.bufferedInputs);
+					this.bufferedInputs = null;
+				}
 				cb();
-			}.bind(this));
+			}.bind(this);
+			if(this.bufferedInputs)
+				addInput();
+			else
+				this.qInputEmpty.take(addInput);
 			this.bufferedInputPos++;
 		}
 	},
@@ -223,14 +315,13 @@ var GFWrapper = {
 			
 			var recData = this.recoveryData;
 			var size = this.chunkSize;
+			var engine = this._engine();
 			if(this.bufferedInputPos) {
-				gf.generate(this.bufferedInputs.slice(0, this.bufferedInputPos), this.bufferedInSlices.slice(0, this.bufferedInputPos), recData, this.recoverySlices, this._mergeRecovery, function() {
-					gf.finish(recData, size, md5);
-					cb();
+				this.bufferedInputs.generate(recData, this.recoverySlices, this._mergeRecovery, function() {
+					engine.finish(recData, size, md5, cb);
 				});
 			} else {
-				gf.finish(recData, size, md5);
-				process.nextTick(cb);
+				engine.finish(recData, size, md5, cb);
 			}
 			//this._processStarted = false;
 			this.bufferedClear(!clear);
@@ -240,13 +331,19 @@ var GFWrapper = {
 			if(this.qInputReady && this.bufferedInputPos) {
 				var self = this;
 				this.qDone = function() {
-					gf.finish(self.recoveryData, self.chunkSize, md5);
-					self._processStarted = false;
-					self.bufferedClear(!clear);
-					self.qDone = null;
-					self.qInputReady = new Queue();
-					cb();
+					self._engine().finish(self.recoveryData, self.chunkSize, md5, function() {
+						self._processStarted = false;
+						self.bufferedClear(!clear);
+						self.qDone = null;
+						self.qInputReady = new Queue();
+						cb();
+					});
 				};
+				// submit partially filled batch
+				if(this.bufferedInputs) {
+					this.qInputReady.add(this.bufferedInputs);
+					this.bufferedInputs = null;
+				}
 				this.qInputReady.finished();
 			} else {
 				// no recovery was actually generated
@@ -254,10 +351,9 @@ var GFWrapper = {
 				this.recoveryData.forEach(function(data) {
 					data.fill(0, 0, data.length); // need to supply defaults if using underlying buffers
 				});
-				gf.finish(this.recoveryData, this.chunkSize, md5); // TODO: this could be optimized
 				this._processStarted = false;
 				this.bufferedClear(!clear);
-				process.nextTick(cb);
+				this._engine().finish(this.recoveryData, this.chunkSize, md5, cb); // TODO: this could be optimized
 			}
 		}
 	},
@@ -268,8 +364,8 @@ var GFWrapper = {
 			this.qInputEmpty = null;
 			this.qInputReady = null;
 			this.bufferedInputs = null;
-			this.bufferedInSlices = null;
-		}
+		} else if(this.bufferedInputs && !this.bgProcessInputs)
+			this.bufferedInputs.count = 0;
 		this.bufferedInputPos = 0;
 		this._mergeRecovery = false;
 	}
@@ -327,6 +423,13 @@ function PAR2(files, sliceSize) {
 PAR2.prototype = {
 	recoveryData: null,
 	recoveryPackets: null,
+	hashQueue: null,
+	
+	// if enabled, file and slice MD5s are computed on the thread pool, rather than in the calling thread; this is only beneficial if multiple files are processed concurrently
+	// slices which are also used for recovery are hashed whilst being copied into the recovery input buffer instead, so this only applies when there's no recovery to compute
+	setHashQueue: function(enable) {
+		this.hashQueue = enable ? new HashQueue() : null;
+	},
 	
 	getFiles: function(keep) {
 		if(keep) return this.files;
@@ -549,9 +652,9 @@ PAR2.prototype = {
 		return pkt;
 	},
 	
-	processSlice: function(data, sliceNum, cb) {
+	processSlice: function(data, sliceNum, cb, hash) {
 		if(this.recoverySlices.length)
-			this.bufferedProcess(data, sliceNum, this.chunkSizeStride, cb);
+			this.bufferedProcess(data, sliceNum, this.chunkSizeStride, cb, hash);
 		else
 			process.nextTick(cb);
 	},
@@ -648,8 +751,8 @@ PAR2File.prototype = {
 	_crcSlice: null,
 	_md5slice: null,
 	
-	_processWriteHash: function(md5, crc) {
-		var chkAddr = 64 + 16 + 20*this.slicePos;
+	_processWriteHash: function(md5, crc, slicePos) {
+		var chkAddr = 64 + 16 + 20*(slicePos === undefined ? this.slicePos : slicePos);
 		md5.copy(this.pktCheck, chkAddr);
 		// need to reverse the CRC
 		this.pktCheck[chkAddr + 16] = crc[3];
@@ -658,6 +761,19 @@ PAR2File.prototype = {
 		this.pktCheck[chkAddr + 19] = crc[0];
 	},
 	
+	// finalises the hashes of a slice whose data has been fed through the file and slice MD5 contexts
+	_processSliceHash: function(md5, crc, dataLen, slicePos, lastPiece) {
+		if(dataLen < this.par2.sliceSize) {
+			gf.md5_update_zeroes(md5, this.par2.sliceSize - dataLen);
+			crc = gf.crc32_zeroes(crc, this.par2.sliceSize - dataLen);
+		}
+		this._processWriteHash(gf.md5_final(md5), crc, slicePos);
+		if(lastPiece) {
+			this.md5 = gf.md5_final(this._md5ctx);
+			this._md5ctx = null;
+		}
+	},
+	
 	process: function(data, cb) {
 			if(this.slicePos >= this.numSlices) throw new Error('Too many slices given');
 			
@@ -672,15 +788,44 @@ PAR2File.prototype = {
 					throw new Error('Invalid data length');
 			}
 		
+		if(this.pktCheck && !this.md5 && this.par2.recoverySlices.length) {
+			// usual case: hashing is done whilst the slice is copied into the recovery input buffer, which may happen later, but before cb is called
+			var self = this, slicePos = this.slicePos;
+			var hash = {
+				md5: [this._md5ctx, md5_init()],
+				done: function(crc) {
+					self._processSliceHash(hash.md5[1], crc, data.length, slicePos, lastPiece);
+				}
+			};
+			this.slicePos++;
+			this.par2.processSlice(data, this.sliceOffset + slicePos, cb, hash);
+			return;
+		}
+		
+		if(this.pktCheck && !this.md5 && this.par2.hashQueue) {
+			// no recovery to compute (so nothing to fuse hashing with): hash on the thread pool instead, batched with other files' slices
+			// data must remain untouched until both the hashing and processSlice are done with it
+			var self = this, slicePos = this.slicePos;
+			var md5 = md5_init(), crc = allocBuffer(4);
+			var pending = 2;
+			var done = function() {
+				if(--pending == 0) cb();
+			};
+			this.par2.hashQueue.add([this._md5ctx, md5], [data, data], [null, crc], function() {
+				self._processSliceHash(md5, crc, data.length, slicePos, lastPiece);
+				done();
+			});
+			this.slicePos++;
+			this.par2.processSlice(data, this.sliceOffset + slicePos, done);
+			return;
+		}
 		// multi-MD5
 		var md5; // piece MD5 context
 		if(this.pktCheck || !this.md5) {
 			if(this.pktCheck && !this.md5) {
 				md5 = md5_init();
 				gf.md5_update2(this._md5ctx, md5, data);
-				if(data.length < this.par2.sliceSize)
-					gf.md5_update_zeroes(md5, this.par2.sliceSize - data.length);
-				md5 = gf.md5_final(md5);
+				this._processSliceHash(md5, gf.crc32(data), data.length, this.slicePos, lastPiece);
 			} else {
 				// only need to do one, use single
 				if(this.pktCheck) {
@@ -698,12 +843,10 @@ PAR2File.prototype = {
 		}
 		
 		// calc slice CRC/MD5
-		if(this.pktCheck) {
-			var crc = y.crc32(data);
-			if(data.length != this.par2.sliceSize) {
-				var zeroLen = this.par2.sliceSize - data.length;
-				crc = y.crc32_combine(crc, y.crc32_zeroes(zeroLen), zeroLen);
-			}
+		if(this.pktCheck && md5) {
+			var crc = gf.crc32(data);
+			if(data.length != this.par2.sliceSize)
+				crc = gf.crc32_zeroes(crc, this.par2.sliceSize - data.length);
 			this._processWriteHash(md5, crc);
 		}
 		
@@ -735,7 +878,7 @@ PAR2File.prototype = {
 				_md5FeedZeroes(this._md5slice, zeroLen);
 				md5 = this._md5slice.digest();
 			}
-			this._crcSlice = y.crc32_combine(this._crcSlice, y.crc32_zeroes(zeroLen), zeroLen);
+			this._crcSlice = gf.crc32_zeroes(this._crcSlice, zeroLen);
 			
 			// write it
 			this._processWriteHash(md5, this._crcSlice);
@@ -765,7 +908,7 @@ PAR2File.prototype = {
 			gf.md5_update2(this._md5ctx, md5_init(), data);
 		}
 		if(this.pktCheck) {
-			this._crcSlice = this._crcSlice ? y.crc32(data, this._crcSlice) : y.crc32(data);
+			this._crcSlice = gf.crc32(data, this._crcSlice);
 		}
 	},
 	processHash: function(data) {
@@ -1038,9 +1181,29 @@ var GF_METHODS = [
 	'xor-sse', 'xorjit-sse', 'xorjit-avx2', 'xorjit-avx512',
 	'affine-sse', 'affine-avx2', 'affine-avx512',
 	'affine2x-sse', 'affine2x-avx2', 'affine2x-avx512',
-	'clmul-neon', 'clmul-sve2'
+	'clmul-neon', 'clmul-sve2',
+	'shuffle256-avx512', 'affine256-avx512',
+	'shuffle-nt-sse', 'shuffle-nt-avx2', 'affine-nt-sse', 'affine-nt-avx2',
+	'xorjit-avx'
 ];
 
+// method/parameters previously tuned for this CPU, used in place of the default method if available
+var tunedMethod = gftune.loadProfile();
+// sets the method on the module's default engine, which is also used for newly created engines
+var applyMethod = function(args) {
+	var info = gf.set_method.apply(gf, args);
+	gfMethodArgs = args;
+	return info;
+};
+var setDefaultMethod = function(sliceSize) {
+	var meth = tunedMethod ? GF_METHODS.indexOf(tunedMethod.method) : -1;
+	// a profile may have been written by a build/host with methods which aren't usable here
+	if(meth > 0 && gf.available_methods().indexOf(meth) >= 0)
+		return applyMethod([meth, sliceSize, tunedMethod.chunk_size, tunedMethod.jit_strat]);
+	return applyMethod([0, sliceSize]);
+};
+gfMethod = setDefaultMethod();
+
 module.exports = {
 	CHAR: CHAR_CONST,
 	RECOVERY_HEADER_SIZE: 68,
@@ -1050,14 +1213,47 @@ module.exports = {
 	getNumThreads: gf.get_num_threads,
 	setMethod: function(method, sliceSize) {
 		// !! will not reset buffers etc; data may become invalid if setting this after processing has started
+		// only affects PAR2 instances which haven't started processing yet
 		var meth = GF_METHODS.indexOf(method);
 		if(meth < 0) throw new Error('Unknown method "' + method + '"');
-		gfMethod = gf.set_method(meth, sliceSize);
+		if(meth == 0)
+			gfMethod = setDefaultMethod(sliceSize);
+		else
+			gfMethod = applyMethod([meth, sliceSize]);
+	},
+	// benchmarks available methods for processing numInputs slices of sliceSize at a time, generating numOutputs recovery slices, and selects the fastest
+	// unless save is false, the result is saved to a per-host profile, used as the default method for later runs
+	autotune: function(sliceSize, numInputs, numOutputs, save) {
+		var results = gftune.tune(sliceSize, numInputs, numOutputs);
+		if(!results.length) throw new Error('No methods could be benchmarked');
+		var best = results[0];
+		tunedMethod = {
+			method: GF_METHODS[best.method],
+			chunk_size: best.chunk_size,
+			jit_strat: best.jit_strat,
+			speed: Math.round(best.speed),
+			slice_size: sliceSize,
+			inputs: numInputs,
+			outputs: numOutputs,
+			threads: gf.get_num_threads()
+		};
+		if(save !== false)
+			gftune.saveProfile(tunedMethod);
+		gfMethod = setDefaultMethod(sliceSize);
+		return results.map(function(r) {
+			return {
+				method: GF_METHODS[r.method],
+				chunkSize: r.chunk_size,
+				jitStrategy: r.jit_strat,
+				speed: r.speed
+			};
+		});
 	},
 	getMethod: function() {
 		return {
 			method: GF_METHODS[gfMethod.method],
-			description: gfMethod.method_desc
+			description: gfMethod.method_desc,
+			cache: gfMethod.cache
 		};
 	},
 	asciiCharset: 'utf-8',
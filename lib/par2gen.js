@@ -152,8 +152,9 @@ function PAR2Gen(fileInfo, sliceSize, opts) {
 		memoryLimit: 256*1048576,
 		minChunkSize: 128*1024, // 0 to disable chunking
 		noChunkFirstPass: false,
-		processBatchSize: null, // default = max(numthreads * 16, ceil(4M/chunkSize))
+		processBatchSize: null, // default = max(numthreads * 16, ceil(max(4M, L3/2)/chunkSize))
 		processBufferSize: null, // default = processBatchSize
+		readConcurrency: null, // number of files read at once in the first pass, allowing them to be hashed in parallel; default = min(4, numthreads)
 		comments: [], // array of strings
 		creator: 'ParPar (library) v' + require('../package').version + ' [https://animetosho.org/app/parpar]',
 		unicode: null, // null => auto, false => never, true => always generate unicode packets
@@ -542,7 +543,9 @@ function PAR2Gen(fileInfo, sliceSize, opts) {
 	if(o.processBatchSize === null) {
 		// calc default
 		// TODO: grabbing number of threads used here isn't ideal :/
-		o.processBatchSize = Math.max(Par2.getNumThreads() * 16, Math.ceil(4096*1024 / this._chunkSize));
+		// aim for a batch of input to fill around half the L3 cache, if it's larger than 4MB
+		var batchBytes = Math.max(4096*1024, (Par2.getMethod().cache.l3 || 0) / 2);
+		o.processBatchSize = Math.max(Par2.getNumThreads() * 16, Math.ceil(batchBytes / this._chunkSize));
 		if(o.processBatchSize*this._chunkSize > 64*1048576 && o.processBatchSize > 16) // if excessively large, scale it down
 			o.processBatchSize = Math.max(Math.min(4, Par2.getNumThreads()) * 4, Math.ceil(64*1048576 / this._chunkSize));
 	}
@@ -556,6 +559,12 @@ function PAR2Gen(fileInfo, sliceSize, opts) {
 		par.setInputBufferSize(o.processBatchSize, 0);
 	}
 	
+	// reading multiple files at once lets their hashes be computed in parallel, by the thread pool rather than the main thread (if recovery is being computed, the hashing is done as slices are copied into the input buffer, otherwise via the hash queue)
+	if(o.readConcurrency === null)
+		o.readConcurrency = Math.min(4, Par2.getNumThreads());
+	o.readConcurrency = Math.max(1, Math.min(o.readConcurrency | 0, this.files.length));
+	par.setHashQueue(o.readConcurrency > 1);
+	
 	// select amount of data to read() for sequential reads
 	this.readSize = o.sliceSize;
 	if(this.readSize < o.seqReadSize) {
@@ -586,7 +595,7 @@ PAR2Gen.prototype = {
 	sliceOffset: 0, // not offset specified by user, rather offset from first pass
 	chunkOffset: 0,
 	readSize: 0,
-	_buf: null,
+	_bufs: null,
 
 	_rfPush: function(numSlices, sliceOffset, critPackets, creator) {
 		var packets, recvSize = 0, critTotalSize = 0;
@@ -880,47 +889,59 @@ PAR2Gen.prototype = {
 		var self = this;
 		var firstPass = (this.passNum == 0 && this.passChunkNum == 0);
 		
-		// use a common buffer as node doesn't handle memory management well with deallocating Buffers
-		if(!this._buf || this._buf.length < this.readSize) {
-			this._buf = allocBuffer(this.readSize);
-		}
+		// use common buffers as node doesn't handle memory management well with deallocating Buffers
+		// each file being read at the same time needs its own buffer
+		var concurrency = firstPass ? this.opts.readConcurrency : 1;
+		if(!this._bufs || this._bufs[0].length < this.readSize)
+			this._bufs = [];
+		while(this._bufs.length < concurrency)
+			this._bufs.push(allocBuffer(this.readSize));
+		var freeBufs = this._bufs.slice();
+		
 		var seeking = (chunkSize != this.opts.sliceSize) && !firstPass;
-		async.eachSeries(this.files, function(file, cb) {
+		async.eachLimit(this.files, concurrency, function(file, cb) {
 			if(cbProgress) cbProgress('processing_file', file);
 			
 			if(file.size == 0) return cb();
+			var buf = freeBufs.pop();
 			fs.open(file.name, 'r', function(err, fd) {
-				if(err) return cb(err);
+				if(err) {
+					freeBufs.push(buf);
+					return cb(err);
+				}
 				
+				// the buffer and file are released even if reading fails, as other files may still be read (or the pass retried)
 				var loopDone = function(err) {
-					if(err) return cb(err);
-					fs.close(fd, cb);
+					freeBufs.push(buf);
+					fs.close(fd, function(closeErr) {
+						cb(err || closeErr);
+					});
 				};
 				if(seeking) {
 					var filePos = self.chunkOffset;
 					// TODO: consider parallel reading of chunks for SSDs
 					async.timesSeries(file.numSlices, function(sliceNum, cb) {
-						fs.read(fd, self._buf, 0, chunkSize, filePos, function(err, bytesRead) {
+						fs.read(fd, buf, 0, chunkSize, filePos, function(err, bytesRead) {
 							if(err) return cb(err);
 							if(cbProgress) cbProgress('processing_slice', file, sliceNum);
 							filePos += self.opts.sliceSize; // advance to next slice
-							self.process(file, self._buf.slice(0, bytesRead), cb);
+							self.process(file, buf.slice(0, bytesRead), cb);
 						});
 					}, loopDone);
 				} else if(self.readSize >= self.opts.sliceSize || (firstPass && self.opts.noChunkFirstPass)) {
 					// sequential read - read multiple blocks at once
 					var slicesPerRead = Math.max(1, Math.floor(self.readSize / self.opts.sliceSize));
 					async.timesSeries(Math.ceil(file.numSlices / slicesPerRead), function(sliceBatchNum, cb) {
-						fs.read(fd, self._buf, 0, self.opts.sliceSize*slicesPerRead, null, function(err, bytesRead) {
+						fs.read(fd, buf, 0, self.opts.sliceSize*slicesPerRead, null, function(err, bytesRead) {
 							if(err) return cb(err);
 							var sliceBatchPos = sliceBatchNum*slicesPerRead;
 							var slicesExpected = Math.min(file.numSlices, slicesPerRead+sliceBatchPos) - sliceBatchPos;
 							if(Math.ceil(bytesRead / self.opts.sliceSize) != slicesExpected)
-								cb(new Error('Data read failure: read ' + bytesRead + ' bytes (' + Math.ceil(bytesRead / self.opts.sliceSize) + ' slices) but expected ' + slicesExpected + ' slices'));
+								return cb(new Error('Data read failure: read ' + bytesRead + ' bytes (' + Math.ceil(bytesRead / self.opts.sliceSize) + ' slices) but expected ' + slicesExpected + ' slices'));
 							async.timesSeries(slicesExpected, function(sliceOffNum, cb) {
 								if(cbProgress) cbProgress('processing_slice', file, sliceBatchPos + sliceOffNum);
 								var bp = sliceOffNum * self.opts.sliceSize;
-								self.process(file, self._buf.slice(bp, Math.min(bytesRead, bp+self.opts.sliceSize)), cb);
+								self.process(file, buf.slice(bp, Math.min(bytesRead, bp+self.opts.sliceSize)), cb);
 							}, cb);
 						});
 					}, loopDone);
@@ -935,14 +956,14 @@ PAR2Gen.prototype = {
 						var chunkProcessed = false;
 						(function readLoop(cb) {
 							if(!sliceLeft) return cb();
-							fs.read(fd, self._buf, 0, Math.min(sliceLeft, self.readSize), null, function(err, bytesRead) {
+							fs.read(fd, buf, 0, Math.min(sliceLeft, self.readSize), null, function(err, bytesRead) {
 								if(err) return cb(err);
 								if(!bytesRead) return cb(); // EOF
 								sliceLeft -= bytesRead;
-								file.processHash(self._buf.slice(0, bytesRead));
+								file.processHash(buf.slice(0, bytesRead));
 								if(!chunkProcessed && self._chunker) { // first part - need to feed to chunker
 									chunkProcessed = true;
-									self._chunker.process(file, self._buf.slice(0, Math.min(chunkSize, bytesRead)), function(err) {
+									self._chunker.process(file, buf.slice(0, Math.min(chunkSize, bytesRead)), function(err) {
 										if(err) cb(err);
 										else readLoop(cb);
 									});
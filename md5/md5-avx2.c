@@ -0,0 +1,27 @@
+#include "md5.h"
+#include <string.h>
+#include "../gf16/md5mb-sse.h"
+
+#ifdef __AVX2__
+int md5_available_avx2 = 1;
+
+void md5_update_avx2(uint32_t *vals, const void** data_, size_t num) {
+	__m256i state[md5mb_regions_avx2 / 2];
+	const char* data[md5mb_regions_avx2];
+	size_t offset = 0;
+	memcpy(state, vals, sizeof(state));
+	memcpy(data, data_, sizeof(data));
+	while(num--) {
+		md5_process_block_mb_avx2(state, data, offset);
+		offset += MD5_BLOCKSIZE;
+	}
+	memcpy(vals, state, sizeof(state));
+	_mm256_zeroupper();
+}
+#else
+int md5_available_avx2 = 0;
+
+void md5_update_avx2(uint32_t *vals, const void** data_, size_t num) {
+	(void)vals; (void)data_; (void)num;
+}
+#endif
@@ -0,0 +1,59 @@
+#include "md5.h"
+#include <string.h>
+#include "../gf16/md5mb-sse.h"
+
+#ifdef __AVX512F__
+int md5_available_avx512 = 1;
+
+void md5_update_avx512(uint32_t *vals, const void** data_, size_t num) {
+	__m512i state[md5mb_regions_avx512 / 4];
+	const char* data[md5mb_regions_avx512];
+	size_t offset = 0;
+	memcpy(state, vals, sizeof(state));
+	memcpy(data, data_, sizeof(data));
+	while(num--) {
+		md5_process_block_mb_avx512(state, data, offset);
+		offset += MD5_BLOCKSIZE;
+	}
+	memcpy(vals, state, sizeof(state));
+	_mm256_zeroupper();
+}
+#else
+int md5_available_avx512 = 0;
+
+void md5_update_avx512(uint32_t *vals, const void** data_, size_t num) {
+	(void)vals; (void)data_; (void)num;
+}
+#endif
+
+
+#include "../gf16/md5x2-sse.h"
+
+#ifdef __AVX512VL__
+int md5x2_available_avx512 = 1;
+
+void md5x2_update_avx512(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	/* same layout as md5x2_update_sse */
+	__m128i state[4];
+	const char* src1 = (const char*)data1;
+	const char* src2 = (const char*)data2;
+	int i;
+	for(i=0; i<4; i++)
+		state[i] = _mm_set_epi32(h2[i], h2[i], h1[i], h1[i]);
+	while(num--) {
+		md5_update_block_x2_avx512(state, src1, src2);
+		src1 += MD5_BLOCKSIZE;
+		src2 += MD5_BLOCKSIZE;
+	}
+	for(i=0; i<4; i++) {
+		h1[i] = _mm_cvtsi128_si32(state[i]);
+		h2[i] = _mm_extract_epi32(state[i], 2);
+	}
+}
+#else
+int md5x2_available_avx512 = 0;
+
+void md5x2_update_avx512(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	(void)h1; (void)h2; (void)data1; (void)data2; (void)num;
+}
+#endif
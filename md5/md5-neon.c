@@ -0,0 +1,58 @@
+#include "md5.h"
+#include <string.h>
+#include "../gf16/platform.h"
+
+#ifdef __ARM_NEON
+#include "../gf16/md5mb-neon.h"
+int md5_available_neon = 1;
+
+void md5_update_neon(uint32_t *vals, const void** data_, size_t num) {
+	uint32x4_t state[md5mb_regions_neon / 2];
+	const char* data[md5mb_regions_neon];
+	size_t offset = 0;
+	memcpy(state, vals, sizeof(state));
+	memcpy(data, data_, sizeof(data));
+	while(num--) {
+		md5_process_block_mb_neon(state, data, offset);
+		offset += MD5_BLOCKSIZE;
+	}
+	memcpy(vals, state, sizeof(state));
+}
+
+#ifdef __GNUC__
+# define MD5_USE_ASM
+# include "../gf16/md5x2-neon-asm.h"
+#endif
+#include "../gf16/md5x2-neon.h"
+#ifdef MD5_USE_ASM
+# undef MD5_USE_ASM
+#endif
+
+void md5x2_update_neon(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	/* lane 0 of each vector holds the first hash, lane 1 the second */
+	uint32x2_t state[4];
+	const char* src1 = (const char*)data1;
+	const char* src2 = (const char*)data2;
+	int i;
+	for(i=0; i<4; i++)
+		state[i] = vset_lane_u32(h2[i], vdup_n_u32(h1[i]), 1);
+	while(num--) {
+		md5_update_block_x2_neon(state, src1, src2);
+		src1 += MD5_BLOCKSIZE;
+		src2 += MD5_BLOCKSIZE;
+	}
+	for(i=0; i<4; i++) {
+		h1[i] = vget_lane_u32(state[i], 0);
+		h2[i] = vget_lane_u32(state[i], 1);
+	}
+}
+#else
+int md5_available_neon = 0;
+
+void md5_update_neon(uint32_t *vals, const void** data_, size_t num) {
+	(void)vals; (void)data_; (void)num;
+}
+void md5x2_update_neon(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	(void)h1; (void)h2; (void)data1; (void)data2; (void)num;
+}
+#endif
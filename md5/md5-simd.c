@@ -10,3 +10,111 @@
 
 #endif
 
+
+#include "../gf16/platform.h"
+
+#ifdef PLATFORM_X86
+# ifdef _MSC_VER
+#  include <intrin.h>
+#  define _cpuid __cpuid
+#  define _cpuidX __cpuidex
+#  if _MSC_VER >= 1600
+#   include <immintrin.h>
+#   define _GET_XCR() _xgetbv(_XCR_XFEATURE_ENABLED_MASK)
+#  endif
+# else
+#  include <cpuid.h>
+#  define _cpuid(ar, eax) __cpuid(eax, ar[0], ar[1], ar[2], ar[3])
+#  define _cpuidX(ar, eax, ecx) __cpuid_count(eax, ecx, ar[0], ar[1], ar[2], ar[3])
+static inline int _GET_XCR() {
+	int xcr0;
+	__asm__ __volatile__("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
+	return xcr0;
+}
+# endif
+#endif
+#ifdef PLATFORM_ARM
+# ifdef __ANDROID__
+#  include <cpu-features.h>
+# elif defined(__linux__)
+#  include <sys/auxv.h>
+#  include <asm/hwcap.h>
+# endif
+#endif
+
+/* default to the compile-time selected implementation, until md5_multi_init is called */
+md5_update_block_fn md5_multi_update_block = &MD5_SIMD_UPDATE_BLOCK;
+unsigned md5_multi_num = MD5_SIMD_NUM;
+unsigned md5_multi_lanes = MD5_SIMD_NUM;
+#ifdef __SSE2__
+md5_update2_block_fn md5_update2_block = &md5x2_update_sse;
+#else
+md5_update2_block_fn md5_update2_block = &md5x2_update_scalar;
+#endif
+
+/* the multi-buffer kernels process two interleaved sets of vectors on x86-64 and ARM, so handle twice as many buffers as there are lanes */
+#if defined(PLATFORM_AMD64) || defined(PLATFORM_ARM)
+# define MD5_MB_SETS 2
+#else
+# define MD5_MB_SETS 1
+#endif
+
+void md5_multi_init(void) {
+#ifdef PLATFORM_X86
+	int hasAVX2 = 0, hasAVX512 = 0, hasAVX512VL = 0;
+# if !defined(_MSC_VER) || _MSC_VER >= 1600
+	int cpuInfo[4];
+	int cpuInfoX[4];
+	_cpuid(cpuInfo, 1);
+	_cpuidX(cpuInfoX, 7, 0);
+	if(cpuInfo[2] & 0x8000000) { /* has OSXSAVE */
+		int xcr = _GET_XCR() & 0xff;
+		if((xcr & 6) == 6) { /* AVX enabled */
+			hasAVX2 = (cpuInfoX[1] & 0x20) == 0x20;
+			if((xcr & 0xE0) == 0xE0) {
+				hasAVX512 = (cpuInfoX[1] & 0x10000) == 0x10000; /* AVX512F */
+				hasAVX512VL = hasAVX512 && (cpuInfoX[1] & 0x80000000) == 0x80000000;
+			}
+		}
+	}
+# endif
+	
+	if(md5x2_available_avx512 && hasAVX512VL)
+		md5_update2_block = &md5x2_update_avx512;
+	
+	if(md5_available_avx512 && hasAVX512) {
+		md5_multi_update_block = &md5_update_avx512;
+		md5_multi_lanes = 16;
+	} else if(md5_available_avx2 && hasAVX2) {
+		md5_multi_update_block = &md5_update_avx2;
+		md5_multi_lanes = 8;
+	} else
+		return;
+	md5_multi_num = md5_multi_lanes * MD5_MB_SETS;
+#endif
+#ifdef PLATFORM_ARM
+	int hasNEON = 0;
+# if defined(AT_HWCAP)
+#  ifdef __aarch64__
+	hasNEON = (getauxval(AT_HWCAP) & HWCAP_ASIMD) != 0;
+#  else
+	hasNEON = (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#  endif
+# elif defined(ANDROID_CPU_FAMILY_ARM)
+#  ifdef __aarch64__
+	hasNEON = (android_getCpuFeatures() & ANDROID_CPU_ARM64_FEATURE_ASIMD) != 0;
+#  else
+	hasNEON = (android_getCpuFeatures() & ANDROID_CPU_ARM_FEATURE_NEON) != 0;
+#  endif
+# elif defined(__aarch64__)
+	hasNEON = 1;
+# endif
+	
+	if(md5_available_neon && hasNEON) {
+		md5_update2_block = &md5x2_update_neon;
+		md5_multi_update_block = &md5_update_neon;
+		md5_multi_lanes = 4;
+		md5_multi_num = md5_multi_lanes * MD5_MB_SETS;
+	}
+#endif
+}
@@ -285,26 +285,21 @@ void md5_init(MD5_CTX *c)
 	c->h[3] = 0x10325476L;
 }
 
-/* TODO: do we care about runtime CPU detection here? */
-void md5_multi_update(MD5_CTX **c, const void **data_, size_t len)
+/* buffers data which can't be processed as whole blocks from data_, returning the number of blocks which can; data is set to where those blocks start for each context */
+static size_t md5_multi_buffer(MD5_CTX **c, const unsigned char **data, const void **data_, unsigned num, size_t len)
 {
-    const unsigned char *data[MD5_SIMD_NUM];
-    uint32_t md5vals[MD5_SIMD_NUM*4];
     size_t n = len / MD5_BLOCKSIZE;
-    int i;
-
-    if (len == 0)
-        return;
+    unsigned i;
 
     if (n) {
          /* firstly, if there's any pending block, reduce number of blocks by 1 */
-        for(i=0; i<MD5_SIMD_NUM; i++)
+        for(i=0; i<num; i++)
             if (c[i]->dataLen != 0) {
                 n--;
                 break;
             }
     }
-    for(i=0; i<MD5_SIMD_NUM; i++) {
+    for(i=0; i<num; i++) {
         size_t leftOver = len - (n*MD5_BLOCKSIZE) + c[i]->dataLen;
         data[i] = data_[i];
         while (leftOver >= MD5_BLOCKSIZE) {
@@ -321,27 +316,64 @@ void md5_multi_update(MD5_CTX **c, const void **data_, size_t len)
             c[i]->dataLen += (int8_t)leftOver;
         }
         c[i]->length += len << 3;
-        /* re-arrange ABCD from contexts to easy to use SIMD form */
-        /* TODO: this should be done by callee? */
-        if(n) {
-            md5vals[0*MD5_SIMD_NUM + i] = c[i]->h[0];
-            md5vals[1*MD5_SIMD_NUM + i] = c[i]->h[1];
-            md5vals[2*MD5_SIMD_NUM + i] = c[i]->h[2];
-            md5vals[3*MD5_SIMD_NUM + i] = c[i]->h[3];
-        }
     }
+    return n;
+}
 
-    if (n > 0) {
-        MD5_SIMD_UPDATE_BLOCK(md5vals, (const void**)data, n);
-        n *= MD5_BLOCKSIZE;
-        for(i=0; i<MD5_SIMD_NUM; i++) {
-            data[i] += n;
-            c[i]->h[0] = md5vals[0*MD5_SIMD_NUM + i];
-            c[i]->h[1] = md5vals[1*MD5_SIMD_NUM + i];
-            c[i]->h[2] = md5vals[2*MD5_SIMD_NUM + i];
-            c[i]->h[3] = md5vals[3*MD5_SIMD_NUM + i];
-        }
+void md5_multi_update(MD5_CTX **c, const void **data_, size_t len)
+{
+    const unsigned char *data[MD5_SIMD_MAX_NUM];
+    uint32_t md5vals[MD5_SIMD_MAX_NUM*4];
+    const unsigned num = md5_multi_num, lanes = md5_multi_lanes;
+    size_t n;
+    unsigned i;
+
+    if (len == 0)
+        return;
+
+    n = md5_multi_buffer(c, data, data_, num, len);
+    if (n == 0)
+        return;
+
+    /* re-arrange ABCD from contexts to easy to use SIMD form */
+    /* each vector holds one of ABCD for `lanes` contexts; kernels which process multiple sets of vectors store them consecutively */
+    for(i=0; i<num; i++) {
+        uint32_t* vals = md5vals + (i / lanes)*lanes*4 + (i % lanes);
+        vals[0*lanes] = c[i]->h[0];
+        vals[1*lanes] = c[i]->h[1];
+        vals[2*lanes] = c[i]->h[2];
+        vals[3*lanes] = c[i]->h[3];
     }
+    md5_multi_update_block(md5vals, (const void**)data, n);
+    for(i=0; i<num; i++) {
+        uint32_t* vals = md5vals + (i / lanes)*lanes*4 + (i % lanes);
+        c[i]->h[0] = vals[0*lanes];
+        c[i]->h[1] = vals[1*lanes];
+        c[i]->h[2] = vals[2*lanes];
+        c[i]->h[3] = vals[3*lanes];
+    }
+}
+
+void md5_update2x(MD5_CTX *c1, MD5_CTX *c2, const void *data1, const void *data2, size_t len)
+{
+    MD5_CTX *c[2];
+    const unsigned char *data[2];
+    const void *src[2];
+    size_t n;
+
+    if (len == 0)
+        return;
+
+    c[0] = c1; c[1] = c2;
+    src[0] = data1; src[1] = data2;
+    n = md5_multi_buffer(c, data, src, 2, len);
+    if (n)
+        md5_update2_block(c1->h, c2->h, data[0], data[1], n);
+}
+
+void md5_update2(MD5_CTX *c1, MD5_CTX *c2, const void *data_, size_t len)
+{
+    md5_update2x(c1, c2, data_, data_, len);
 }
 
 void md5_update_zeroes(MD5_CTX *c, size_t len)
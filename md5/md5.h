@@ -12,7 +12,12 @@ typedef struct {
 
 void md5_final(unsigned char md[16], MD5_CTX *c);
 void md5_init(MD5_CTX *c);
+/* updates md5_multi_num contexts, each with its own buffer of the same length */
 void md5_multi_update(MD5_CTX **c, const void **data_, size_t len);
+/* updates two contexts with the same data, which may have different amounts buffered */
+void md5_update2(MD5_CTX *c1, MD5_CTX *c2, const void *data_, size_t len);
+/* updates two contexts, each with its own buffer of the same length */
+void md5_update2x(MD5_CTX *c1, MD5_CTX *c2, const void *data1, const void *data2, size_t len);
 void md5_update_zeroes(MD5_CTX *c, size_t len);
 
 
@@ -31,3 +36,31 @@ void md5_update_zeroes(MD5_CTX *c, size_t len);
 #endif
 
 void MD5_SIMD_UPDATE_BLOCK(uint32_t *vals_, const void** data_, size_t num);
+
+
+/* multi-buffer implementation, selected at runtime by md5_multi_init */
+#define MD5_SIMD_MAX_NUM 32
+extern unsigned md5_multi_num;
+void md5_multi_init(void);
+
+typedef void(*md5_update_block_fn)(uint32_t *vals_, const void** data_, size_t num);
+extern md5_update_block_fn md5_multi_update_block;
+extern unsigned md5_multi_lanes;
+
+/* two-stream implementation for md5_update2, also selected by md5_multi_init */
+typedef void(*md5_update2_block_fn)(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num);
+extern md5_update2_block_fn md5_update2_block;
+
+extern int md5_available_avx2;
+extern int md5_available_avx512;
+extern int md5_available_neon;
+void md5_update_avx2(uint32_t *vals_, const void** data_, size_t num);
+void md5_update_avx512(uint32_t *vals_, const void** data_, size_t num);
+void md5_update_neon(uint32_t *vals_, const void** data_, size_t num);
+
+extern int md5x2_available_sse;
+extern int md5x2_available_avx512;
+void md5x2_update_scalar(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num);
+void md5x2_update_sse(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num);
+void md5x2_update_avx512(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num);
+void md5x2_update_neon(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num);
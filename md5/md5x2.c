@@ -0,0 +1,49 @@
+#include "md5.h"
+#include "../gf16/md5x2-scalar.h"
+#include "../gf16/md5x2-sse.h"
+
+/* two-stream kernels used by md5_update2; each processes `num` blocks from each data pointer, updating h1 and h2 respectively */
+
+void md5x2_update_scalar(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	uint32_t state[8];
+	const char* src1 = (const char*)data1;
+	const char* src2 = (const char*)data2;
+	memcpy(state, h1, 16);
+	memcpy(state + 4, h2, 16);
+	while(num--) {
+		md5_update_block_x2_scalar(state, src1, src2);
+		src1 += MD5_BLOCKSIZE;
+		src2 += MD5_BLOCKSIZE;
+	}
+	memcpy(h1, state, 16);
+	memcpy(h2, state + 4, 16);
+}
+
+#ifdef __SSE2__
+int md5x2_available_sse = 1;
+
+void md5x2_update_sse(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	/* the first hash is held in lane 0 of each vector, the second in lane 2 */
+	__m128i state[4];
+	const char* src1 = (const char*)data1;
+	const char* src2 = (const char*)data2;
+	int i;
+	for(i=0; i<4; i++)
+		state[i] = _mm_set_epi32(h2[i], h2[i], h1[i], h1[i]);
+	while(num--) {
+		md5_update_block_x2_sse(state, src1, src2);
+		src1 += MD5_BLOCKSIZE;
+		src2 += MD5_BLOCKSIZE;
+	}
+	for(i=0; i<4; i++) {
+		h1[i] = _mm_cvtsi128_si32(state[i]);
+		h2[i] = _mm_cvtsi128_si32(_mm_unpackhi_epi64(state[i], state[i]));
+	}
+}
+#else
+int md5x2_available_sse = 0;
+
+void md5x2_update_sse(uint32_t *h1, uint32_t *h2, const void* data1, const void* data2, size_t num) {
+	(void)h1; (void)h2; (void)data1; (void)data2; (void)num;
+}
+#endif
@@ -1,12 +1,16 @@
 
 #include <node.h>
 #include <node_buffer.h>
+#include <node_object_wrap.h>
 #include <node_version.h>
 #include <v8.h>
 #include <stdlib.h>
 //#include <inttypes.h>
 #include <string.h>
 #include <uv.h>
+#include <vector>
+#include <map>
+#include <algorithm>
 
 #if defined(_MSC_VER)
 #include <malloc.h>
@@ -15,14 +19,10 @@
 #include "../gf16/module.h"
 
 extern "C" {
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 #include "../md5/md5.h"
+#include "../crc/crc32.h"
 }
 
-static int MEM_ALIGN, MEM_STRIDE;
-
 
 using namespace v8;
 
@@ -77,29 +77,95 @@ using namespace v8;
 #if NODE_VERSION_AT_LEAST(12, 0, 0)
 # define SET_OBJ(obj, key, val) (obj)->Set(isolate->GetCurrentContext(), NEW_STRING(key), val).Check()
 # define GET_ARR(obj, idx) (obj)->Get(isolate->GetCurrentContext(), idx).ToLocalChecked()
+# define SET_ARR(obj, idx, val) (obj)->Set(isolate->GetCurrentContext(), idx, val).Check()
 #else
 # define SET_OBJ(obj, key, val) (obj)->Set(NEW_STRING(key), val)
 # define GET_ARR(obj, idx) (obj)->Get(idx)
+# define SET_ARR(obj, idx, val) (obj)->Set(idx, val)
 #endif
 
 
+// a GF engine, exposed to JS as gf.Engine; each engine has its own method, and can run jobs independently of other engines
+// the module level functions operate on a default engine, which isn't exposed as an object
+// all engines share the same threads, so changing the number of threads or tiling is only allowed when no engine has any jobs in flight
+class GfEngine : public node::ObjectWrap {
+public:
+	ppgf_engine* engine;
+	int activeTasks;
+	int memAlign, memStride;
+	
+	// number of jobs in flight, across all engines
+	static int totalActiveTasks;
+	
+	GfEngine() : activeTasks(0) {
+		engine = ppgf_engine_create();
+		updateMethod();
+	}
+	~GfEngine() {
+		ppgf_engine_destroy(engine);
+	}
+	void updateMethod() {
+		int rMethod;
+		const char* rMethLong;
+		ppgf_get_method(engine, &rMethod, &rMethLong, &memAlign, &memStride);
+	}
+	void wrap(Local<Object> obj) {
+		Wrap(obj);
+	}
+};
+int GfEngine::totalActiveTasks = 0;
+static GfEngine* defaultEngine = NULL;
+
+static Persistent<FunctionTemplate> engineTemplate;
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+# define IS_ENGINE(obj) Local<FunctionTemplate>::New(isolate, engineTemplate)->HasInstance(obj)
+#else
+# define IS_ENGINE(obj) engineTemplate->HasInstance(obj)
+#endif
+// functions are shared between the module and Engine objects; determine which engine to use from how the function was called
+#define GET_ENGINE GfEngine* engine = IS_ENGINE(args.This()) ? node::ObjectWrap::Unwrap<GfEngine>(args.This()) : defaultEngine
 
-int mmActiveTasks = 0;
+FUNC(EngineNew) {
+	FUNC_START;
+	
+	if (!args.IsConstructCall())
+		RETURN_ERROR("Engine must be created with new");
+	
+	GfEngine* engine = new GfEngine();
+	engine->wrap(args.This());
+	
+	RETURN_VAL(args.This());
+}
 
-#ifdef _OPENMP
 FUNC(SetMaxThreads) {
 	FUNC_START;
 	
 	if (args.Length() < 1)
 		RETURN_ERROR("Argument required");
-	if (mmActiveTasks)
+	if (GfEngine::totalActiveTasks)
 		RETURN_ERROR("Calculation already in progress");
 	
 	ppgf_set_num_threads(ARG_TO_INT(args[0]));
 	
 	RETURN_UNDEF
 }
+
+FUNC(SetTiling) {
+	FUNC_START;
+	
+	if (args.Length() < 1)
+		RETURN_ERROR("Argument required");
+	if (GfEngine::totalActiveTasks)
+		RETURN_ERROR("Calculation already in progress");
+	
+#if NODE_VERSION_AT_LEAST(8, 0, 0)
+	ppgf_set_tiling(args[0].As<Boolean>()->Value());
+#else
+	ppgf_set_tiling(args[0]->ToBoolean()->Value());
 #endif
+	
+	RETURN_UNDEF
+}
 
 FUNC(GetNumThreads) {
 	FUNC_START;
@@ -108,6 +174,7 @@ FUNC(GetNumThreads) {
 
 FUNC(PrepInput) {
 	FUNC_START;
+	GET_ENGINE;
 	
 	if (args.Length() < 2 || !node::Buffer::HasInstance(args[0]) || !node::Buffer::HasInstance(args[1]))
 		RETURN_ERROR("Two Buffers required");
@@ -117,18 +184,50 @@ FUNC(PrepInput) {
 	char* dest = node::Buffer::Data(args[1]);
 	char* src = node::Buffer::Data(args[0]);
 	
-	if((uintptr_t)dest & (MEM_ALIGN-1))
+	if((uintptr_t)dest & (engine->memAlign-1))
 		RETURN_ERROR("Destination not aligned");
-	if(((inputLen + (MEM_STRIDE-1)) & ~(MEM_STRIDE-1)) > destLen)
+	if(((inputLen + (engine->memStride-1)) & ~(engine->memStride-1)) > destLen)
 		RETURN_ERROR("Destination not large enough to hold input");
 	
-	ppgf_prep_input(destLen, inputLen, dest, src);
+	ppgf_prep_input(engine->engine, destLen, inputLen, dest, src);
+	
+	RETURN_UNDEF
+}
+
+FUNC(PrepInputPacked) {
+	FUNC_START;
+	GET_ENGINE;
+	
+	if (args.Length() < 5 || !node::Buffer::HasInstance(args[0]) || !node::Buffer::HasInstance(args[1]))
+		RETURN_ERROR("Two Buffers and three integers required");
+	
+	size_t destLen = node::Buffer::Length(args[1]),
+		inputLen = node::Buffer::Length(args[0]);
+	char* dest = node::Buffer::Data(args[1]);
+	const char* src = node::Buffer::Data(args[0]);
+	size_t sliceLen = (size_t)ARG_TO_INT(args[2]);
+	int inputNum = ARG_TO_INT(args[3]);
+	int packSize = ARG_TO_INT(args[4]);
+	
+	if((uintptr_t)dest & (engine->memAlign-1))
+		RETURN_ERROR("Destination not aligned");
+	if(!sliceLen || (sliceLen & (engine->memStride-1)) != 0)
+		RETURN_ERROR("Slice length must be a multiple of stride");
+	if(inputLen > sliceLen)
+		RETURN_ERROR("Input larger than slice length");
+	if(packSize < 1 || packSize > 65536 || inputNum < 0 || inputNum >= packSize)
+		RETURN_ERROR("Invalid input number or pack size");
+	if(sliceLen * packSize > destLen)
+		RETURN_ERROR("Destination not large enough to hold inputs");
+	
+	ppgf_prep_input_packed(engine->engine, sliceLen, inputLen, dest, src, inputNum, packSize);
 	
 	RETURN_UNDEF
 }
 
 FUNC(AlignmentOffset) {
 	FUNC_START;
+	GET_ENGINE;
 	
 	if (args.Length() < 1)
 		RETURN_ERROR("Argument required");
@@ -136,7 +235,7 @@ FUNC(AlignmentOffset) {
 	if (!node::Buffer::HasInstance(args[0]))
 		RETURN_ERROR("Argument must be a Buffer");
 	
-	RETURN_VAL( Integer::New(ISOLATE (intptr_t)node::Buffer::Data(args[0]) & (MEM_ALIGN-1)) );
+	RETURN_VAL( Integer::New(ISOLATE (intptr_t)node::Buffer::Data(args[0]) & (engine->memAlign-1)) );
 }
 
 #define CLEANUP_MM { \
@@ -148,27 +247,39 @@ FUNC(AlignmentOffset) {
 
 
 // async stuff
-struct MMRequest {
-	~MMRequest() {
+// jobs are run on the thread pool, which signals the main thread via done_async_ once complete, so that the JS callback can be invoked
+struct AsyncRequest {
+	virtual ~AsyncRequest() {
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
-		inputBuffers.Reset();
-		outputBuffers.Reset();
 		obj_.Reset();
 #else
-		inputBuffers.Dispose();
-		outputBuffers.Dispose();
 		//if (obj_.IsEmpty()) return;
 		obj_.Dispose();
 		obj_.Clear();
 #endif
-		CLEANUP_MM
 	};
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
 	Isolate* isolate;
 #endif
 	Persistent<Object> obj_;
-	uv_work_t work_req_;
+	uv_async_t done_async_;
+	GfEngine* engine;
+};
+
+struct MMRequest : public AsyncRequest {
+	~MMRequest() {
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+		inputBuffers.Reset();
+		outputBuffers.Reset();
+#else
+		inputBuffers.Dispose();
+		outputBuffers.Dispose();
+#endif
+		CLEANUP_MM
+	};
 	
+	const void* packedInput; // if non-NULL, inputs are packed, and the inputs array isn't used
+	unsigned int packSize;
 	const void* const* inputs;
 	uint_fast16_t* iNums;
 	unsigned int numInputs;
@@ -179,21 +290,27 @@ struct MMRequest {
 	bool add;
 	
 	// persist copies of buffers for the duration of the job
-	Persistent<Array> inputBuffers;
+	Persistent<Object> inputBuffers;
 	Persistent<Array> outputBuffers;
 };
 
-static void MMWork(uv_work_t* work_req) {
-	MMRequest* req = (MMRequest*)work_req->data;
-	ppgf_multiply_mat(
-		req->inputs, req->iNums, req->numInputs, req->len, req->outputs, req->oNums, req->numOutputs, req->add
-	);
+// called from a worker thread
+static void AsyncDone(void* arg) {
+	AsyncRequest* req = (AsyncRequest*)arg;
+	uv_async_send(&req->done_async_);
+}
+static void AsyncClose(uv_handle_t* handle) {
+	delete (AsyncRequest*)handle->data;
 }
-static void MMAfter(uv_work_t* work_req, int status) {
-	assert(status == 0);
-	MMRequest* req = (MMRequest*)work_req->data;
+#if UV_VERSION_MAJOR < 1
+static void AsyncAfter(uv_async_t* handle, int) {
+#else
+static void AsyncAfter(uv_async_t* handle) {
+#endif
+	AsyncRequest* req = (AsyncRequest*)handle->data;
 	
-	mmActiveTasks--;
+	if(req->engine) req->engine->activeTasks--;
+	GfEngine::totalActiveTasks--;
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
 	HandleScope scope(req->isolate);
 	Local<Object> obj = Local<Object>::New(req->isolate, req->obj_);
@@ -209,14 +326,34 @@ static void MMAfter(uv_work_t* work_req, int status) {
 	node::MakeCallback(req->obj_, "ondone", 0, NULL);
 #endif
 	
-	delete req;
+	uv_close((uv_handle_t*)handle, AsyncClose);
+}
+// must be called before the request's job is submitted; AsyncDone must be called once the job completes
+// requests which don't use a GF engine (e.g. hashing) have a NULL engine, but still count towards totalActiveTasks as they occupy the thread pool
+static void AsyncStart(AsyncRequest* req) {
+	if(req->engine) req->engine->activeTasks++;
+	GfEngine::totalActiveTasks++;
+	req->done_async_.data = req;
+	uv_async_init(uv_default_loop(), &req->done_async_, AsyncAfter);
+}
+
+// queues the request's job to the thread pool; the job's JS callback is then invoked on the main thread when done
+static void MMSubmit(MMRequest* req) {
+	AsyncStart(req);
+	if(req->packedInput)
+		ppgf_multiply_mat_packed(
+			req->engine->engine, req->packedInput, req->packSize, req->iNums, req->numInputs, req->len, req->outputs, req->oNums, req->numOutputs, req->add, AsyncDone, req
+		);
+	else
+		ppgf_multiply_mat(
+			req->engine->engine, req->inputs, req->iNums, req->numInputs, req->len, req->outputs, req->oNums, req->numOutputs, req->add, AsyncDone, req
+		);
 }
 
 FUNC(MultiplyMulti) {
 	FUNC_START;
+	GET_ENGINE;
 	
-	if (mmActiveTasks)
-		RETURN_ERROR("Calculation already in progress");
 	if (args.Length() < 4)
 		RETURN_ERROR("4 arguments required");
 	
@@ -256,7 +393,7 @@ FUNC(MultiplyMulti) {
 		
 		inputs[i] = node::Buffer::Data(input);
 		uintptr_t inputAddr = (uintptr_t)inputs[i];
-		if (inputAddr & (MEM_ALIGN-1))
+		if (inputAddr & (engine->memAlign-1))
 			RTN_ERROR("All input buffers must be address aligned");
 		
 		if(i) {
@@ -264,7 +401,7 @@ FUNC(MultiplyMulti) {
 				RTN_ERROR("All inputs' length must be equal");
 		} else {
 			len = node::Buffer::Length(input);
-			if ((len & (MEM_STRIDE-1)) != 0)
+			if ((len & (engine->memStride-1)) != 0)
 				RTN_ERROR("Length of input must be a multiple of stride");
 		}
 		
@@ -283,7 +420,7 @@ FUNC(MultiplyMulti) {
 			RTN_ERROR("All outputs' length must equal or greater than the input's length");
 		// the length of output buffers should all be equal, but I'm too lazy to check for that :P
 		outputs[i] = node::Buffer::Data(output);
-		if ((uintptr_t)outputs[i] & (MEM_ALIGN-1))
+		if ((uintptr_t)outputs[i] & (engine->memAlign-1))
 			RTN_ERROR("All output buffers must be address aligned");
 		int rbNum = ARG_TO_INT(GET_ARR(oRBNums, i));
 		if (rbNum < 0 || rbNum > 65535)
@@ -302,16 +439,15 @@ FUNC(MultiplyMulti) {
 #endif
 	}
 	
-	ppgf_maybe_setup_gf();
-	
 	if (args.Length() >= 6 && args[5]->IsFunction()) {
 		MMRequest* req = new MMRequest();
-		req->work_req_.data = req;
+		req->engine = engine;
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
 		// use BaseObject / AsyncWrap instead? meh
 		req->isolate = isolate;
 #endif
 		
+		req->packedInput = NULL;
 		req->inputs = inputs;
 		req->iNums = iNums;
 		req->numInputs = numInputs;
@@ -324,6 +460,7 @@ FUNC(MultiplyMulti) {
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
 		Local<Object> obj = Object::New(isolate);
 		SET_OBJ(obj, "ondone", args[5]);
+		SET_OBJ(obj, "engine", args.This()); // prevent the engine being GC'd whilst in use
 		req->obj_.Reset(ISOLATE obj);
 		//if (env->in_domain())
 		//	req->obj_->Set(env->domain_string(), env->domain_array()->Get(0));
@@ -334,38 +471,194 @@ FUNC(MultiplyMulti) {
 #else
 		req->obj_ = Persistent<Object>::New(ISOLATE Object::New());
 		req->obj_->Set(NEW_STRING("ondone"), args[5]);
+		req->obj_->Set(NEW_STRING("engine"), args.This());
 		//SetActiveDomain(req->obj_); // never set in node_zlib.cc - perhaps domains aren't that important?
 		
 		// keep a copy of the buffers so that they don't get GC'd whilst being written to
-		req->inputBuffers = Persistent<Array>::New(ISOLATE Local<Array>::Cast(args[0]));
+		req->inputBuffers = Persistent<Object>::New(ISOLATE Local<Array>::Cast(args[0]));
 		req->outputBuffers = Persistent<Array>::New(ISOLATE Local<Array>::Cast(args[2]));
 #endif
 		
-		mmActiveTasks++;
-		uv_queue_work(
+		MMSubmit(req);
+		// does req->obj_ need to be returned?
+	} else {
+		ppgf_multiply_mat(
+			engine->engine, inputs, iNums, numInputs,
+			len, outputs, oNums, numOutputs, add, NULL, NULL
+		);
+		CLEANUP_MM
+	}
+	RETURN_UNDEF
+}
+
+FUNC(MultiplyPacked) {
+	FUNC_START;
+	GET_ENGINE;
+	
+	if (args.Length() < 6)
+		RETURN_ERROR("6 arguments required");
+	
+	if (!node::Buffer::HasInstance(args[0]))
+		RETURN_ERROR("Input must be a Buffer");
+	if (!args[3]->IsArray())
+		RETURN_ERROR("inputBlockNumbers must be an array");
+	if (!args[4]->IsArray() || !args[5]->IsArray())
+		RETURN_ERROR("Outputs and recoveryBlockNumbers must be arrays");
+	
+	const void* input = node::Buffer::Data(args[0]);
+	size_t len = (size_t)ARG_TO_INT(args[1]);
+	int packSize = ARG_TO_INT(args[2]);
+	unsigned int numInputs = Local<Array>::Cast(args[3])->Length();
+	unsigned int numOutputs = Local<Array>::Cast(args[4])->Length();
+	
+	if ((uintptr_t)input & (engine->memAlign-1))
+		RETURN_ERROR("Input buffer must be address aligned");
+	if (!len || (len & (engine->memStride-1)) != 0)
+		RETURN_ERROR("Slice length must be a multiple of stride");
+	if (packSize < 1 || packSize > 65536)
+		RETURN_ERROR("Invalid pack size");
+	if (len * packSize > node::Buffer::Length(args[0]))
+		RETURN_ERROR("Input buffer too small for specified slice length and pack size");
+	if (numInputs < 1 || numInputs > (unsigned)packSize)
+		RETURN_ERROR("Number of inputs must be between 1 and the pack size");
+	if (numOutputs != Local<Array>::Cast(args[5])->Length())
+		RETURN_ERROR("Output and recoveryBlockNumber arrays must have the same length");
+	
+	Local<Object> oIBNums = ARG_TO_OBJ(args[3]);
+	void** inputs = NULL;
+	uint_fast16_t* iNums = new uint_fast16_t[numInputs];
+	
+	Local<Object> oOutputs = ARG_TO_OBJ(args[4]);
+	Local<Object> oRBNums = ARG_TO_OBJ(args[5]);
+	void** outputs = new void*[numOutputs];
+	uint_fast16_t* oNums = new uint_fast16_t[numOutputs];
+	
+	#define RTN_ERROR(m) { \
+		CLEANUP_MM \
+		RETURN_ERROR(m); \
+	}
+	
+	for(unsigned int i = 0; i < numInputs; i++) {
+		int ibNum = ARG_TO_INT(GET_ARR(oIBNums, i));
+		if (ibNum < 0 || ibNum > 32767)
+			RTN_ERROR("Invalid input block number specified");
+		iNums[i] = ibNum;
+	}
+	
+	for(unsigned int i = 0; i < numOutputs; i++) {
+		Local<Value> output = GET_ARR(oOutputs, i);
+		if (!node::Buffer::HasInstance(output))
+			RTN_ERROR("All outputs must be Buffers");
+		if (node::Buffer::Length(output) < len)
+			RTN_ERROR("All outputs' length must equal or greater than the slice length");
+		outputs[i] = node::Buffer::Data(output);
+		if ((uintptr_t)outputs[i] & (engine->memAlign-1))
+			RTN_ERROR("All output buffers must be address aligned");
+		int rbNum = ARG_TO_INT(GET_ARR(oRBNums, i));
+		if (rbNum < 0 || rbNum > 65535)
+			RTN_ERROR("Invalid recovery block number specified");
+		oNums[i] = rbNum;
+	}
+	
+	#undef RTN_ERROR
+	
+	bool add = false;
+	if (args.Length() >= 7) {
+#if NODE_VERSION_AT_LEAST(8, 0, 0)
+		add = args[6].As<Boolean>()->Value();
+#else
+		add = args[6]->ToBoolean()->Value();
+#endif
+	}
+	
+	if (args.Length() >= 8 && args[7]->IsFunction()) {
+		MMRequest* req = new MMRequest();
+		req->engine = engine;
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+		req->isolate = isolate;
+#endif
+		
+		req->packedInput = input;
+		req->packSize = packSize;
+		req->inputs = inputs;
+		req->iNums = iNums;
+		req->numInputs = numInputs;
+		req->len = len;
+		req->outputs = outputs;
+		req->oNums = oNums;
+		req->numOutputs = numOutputs;
+		req->add = add;
+		
 #if NODE_VERSION_AT_LEAST(0, 11, 0)
-			//env->event_loop(),
-			uv_default_loop(),
+		Local<Object> obj = Object::New(isolate);
+		SET_OBJ(obj, "ondone", args[7]);
+		SET_OBJ(obj, "engine", args.This());
+		req->obj_.Reset(ISOLATE obj);
+		
+		// keep a copy of the buffers so that they don't get GC'd whilst being written to
+		req->inputBuffers.Reset(ISOLATE ARG_TO_OBJ(args[0]));
+		req->outputBuffers.Reset(ISOLATE Local<Array>::Cast(args[4]));
 #else
-			uv_default_loop(),
+		req->obj_ = Persistent<Object>::New(ISOLATE Object::New());
+		req->obj_->Set(NEW_STRING("ondone"), args[7]);
+		req->obj_->Set(NEW_STRING("engine"), args.This());
+		
+		// keep a copy of the buffers so that they don't get GC'd whilst being written to
+		req->inputBuffers = Persistent<Object>::New(ISOLATE ARG_TO_OBJ(args[0]));
+		req->outputBuffers = Persistent<Array>::New(ISOLATE Local<Array>::Cast(args[4]));
 #endif
-			&req->work_req_,
-			MMWork,
-			MMAfter
-		);
-		// does req->obj_ need to be returned?
+		
+		MMSubmit(req);
 	} else {
-		ppgf_multiply_mat(
-			inputs, iNums, numInputs,
-			len, outputs, oNums, numOutputs, add
+		ppgf_multiply_mat_packed(
+			engine->engine, input, packSize, iNums, numInputs,
+			len, outputs, oNums, numOutputs, add, NULL, NULL
 		);
 		CLEANUP_MM
 	}
 	RETURN_UNDEF
 }
 
+struct FinishRequest : public AsyncRequest {
+	~FinishRequest() {
+		delete[] inputs;
+		delete[] md5;
+	};
+	
+	uint16_t** inputs;
+	MD5_CTX** md5; // NULL if not computing MD5
+	MD5_CTX dummyMd5;
+	unsigned int numInputs;
+	size_t len;
+	size_t bufLen;
+	size_t blockLen;
+};
+
+// untransform and hash a group of md5_multi_num inputs together, a block at a time, so that the hashing reads from cache instead of memory
+static void finish_md5_item(void* arg, unsigned int item, unsigned int) {
+	const FinishRequest& req = *(const FinishRequest*)arg;
+	unsigned int first = item * md5_multi_num;
+	unsigned int numFinish = req.numInputs - first;
+	if(numFinish > md5_multi_num) numFinish = md5_multi_num;
+	
+	const char* data[MD5_SIMD_MAX_NUM];
+	for(size_t offset = 0; offset < req.bufLen; offset += req.blockLen) {
+		size_t blockLen = req.bufLen - offset;
+		if(blockLen > req.blockLen) blockLen = req.blockLen;
+		// padding slots refer to an input in this group, so must not be untransformed twice
+		for(unsigned int i = 0; i < numFinish; i++)
+			ppgf_finish_partial(req.engine->engine, (char*)req.inputs[first+i] + offset, blockLen);
+		
+		if(offset >= req.len) continue;
+		for(unsigned int i = 0; i < md5_multi_num; i++)
+			data[i] = (const char*)req.inputs[first+i] + offset;
+		md5_multi_update(req.md5 + first, (const void**)data, offset + blockLen > req.len ? req.len - offset : blockLen);
+	}
+}
+
 FUNC(Finish) {
 	FUNC_START;
+	GET_ENGINE;
 	
 	if (args.Length() < 2)
 		RETURN_ERROR("At least two arguments required");
@@ -373,9 +666,10 @@ FUNC(Finish) {
 	if (!args[0]->IsArray())
 		RETURN_ERROR("First argument must be an array");
 	
+	bool async = args.Length() >= 4 && args[3]->IsFunction();
 	unsigned int numInputs = Local<Array>::Cast(args[0])->Length();
 	unsigned int allocArrSize = numInputs;
-	if(numInputs < 1) RETURN_UNDEF
+	if(numInputs < 1 && !async) RETURN_UNDEF
 	
 	Local<Object> oInputs = ARG_TO_OBJ(args[0]);
 	bool calcMd5 = false;
@@ -384,16 +678,21 @@ FUNC(Finish) {
 			RETURN_ERROR("MD5 contexts not an array");
 		if (Local<Array>::Cast(args[2])->Length() != numInputs)
 			RETURN_ERROR("Number of MD5 contexts doesn't equal number of inputs");
-		calcMd5 = true;
+		calcMd5 = numInputs > 0;
 		
-		if(numInputs % MD5_SIMD_NUM)
+		if(numInputs % md5_multi_num)
 			// if calculating MD5, allocate some more space to make parallel processing easier
-			allocArrSize += MD5_SIMD_NUM - (numInputs % MD5_SIMD_NUM);
+			allocArrSize += md5_multi_num - (numInputs % md5_multi_num);
 	}
-	uint16_t** inputs = new uint16_t*[allocArrSize];
+	FinishRequest* req = new FinishRequest();
+	req->engine = engine;
+	req->inputs = new uint16_t*[allocArrSize];
+	req->md5 = NULL;
+	req->numInputs = numInputs;
+	uint16_t** inputs = req->inputs;
 	
 	#define RTN_ERROR(m) { \
-		delete[] inputs; \
+		delete req; \
 		RETURN_ERROR(m); \
 	}
 	
@@ -416,54 +715,69 @@ FUNC(Finish) {
 		} else {
 			bufLen = currentLen;
 		}
-		if((uintptr_t)(node::Buffer::Data(input)) & (MEM_ALIGN-1))
-			RETURN_ERROR("All inputs' must be aligned");
+		if((uintptr_t)(node::Buffer::Data(input)) & (engine->memAlign-1))
+			RTN_ERROR("All inputs' must be aligned");
 	}
-	if ((bufLen & (MEM_STRIDE-1)) != 0)
+	if ((bufLen & (engine->memStride-1)) != 0)
 		RTN_ERROR("Length of input must be a multiple of stride");
-	#undef RTN_ERROR
+	req->len = len;
+	req->bufLen = bufLen;
 	
-	MD5_CTX** md5 = NULL;
-	MD5_CTX dummyMd5;
 	if(calcMd5) {
 		Local<Object> oMd5 = ARG_TO_OBJ(args[2]);
-		md5 = new MD5_CTX*[allocArrSize];
+		MD5_CTX** md5 = req->md5 = new MD5_CTX*[allocArrSize];
 		
 		unsigned int i = 0;
 		for(; i < numInputs; i++) {
 			Local<Value> md5Ctx = GET_ARR(oMd5, i);
-			if (!node::Buffer::HasInstance(md5Ctx) || node::Buffer::Length(md5Ctx) != sizeof(MD5_CTX)) {
-				delete[] inputs;
-				delete[] md5;
-				RETURN_ERROR("Invalid MD5 contexts provided");
-			}
+			if (!node::Buffer::HasInstance(md5Ctx) || node::Buffer::Length(md5Ctx) != sizeof(MD5_CTX))
+				RTN_ERROR("Invalid MD5 contexts provided");
 			md5[i] = (MD5_CTX*)node::Buffer::Data(md5Ctx);
-			if(md5[i]->dataLen > MD5_BLOCKSIZE) {
-				delete[] inputs;
-				delete[] md5;
-				RETURN_ERROR("Invalid MD5 contexts provided");
-			}
+			if(md5[i]->dataLen > MD5_BLOCKSIZE)
+				RTN_ERROR("Invalid MD5 contexts provided");
 		}
 		// for padding, fill with dummy pointers
 		for(; i < allocArrSize; i++) {
-			md5[i] = &dummyMd5;
-			inputs[i] = inputs[0];
+			md5[i] = &req->dummyMd5;
+			inputs[i] = inputs[numInputs-1];
 		}
-		dummyMd5.dataLen = md5[0]->dataLen;
+		req->dummyMd5.dataLen = md5[0]->dataLen;
+		req->blockLen = ppgf_get_finish_block_size(engine->engine, md5_multi_num, MD5_BLOCKSIZE);
 	}
+	#undef RTN_ERROR
 	
-	// TODO: make this stuff async
-	ppgf_finish_input(numInputs, inputs, bufLen);
-	if(calcMd5) {
-		int i=0;
-		#pragma omp parallel for num_threads(ppgf_get_num_threads())
-		for(i=0; i<(int)numInputs; i+=MD5_SIMD_NUM) {
-			md5_multi_update(md5 + i, (const void**)(inputs + i), len);
-		}
-		delete[] md5;
+	if (async) {
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+		req->isolate = isolate;
+		Local<Object> obj = Object::New(isolate);
+		SET_OBJ(obj, "ondone", args[3]);
+		SET_OBJ(obj, "engine", args.This());
+		// keep the buffers referenced until the job completes
+		SET_OBJ(obj, "inputs", args[0]);
+		SET_OBJ(obj, "md5", args[2]);
+		req->obj_.Reset(ISOLATE obj);
+#else
+		req->obj_ = Persistent<Object>::New(ISOLATE Object::New());
+		req->obj_->Set(NEW_STRING("ondone"), args[3]);
+		req->obj_->Set(NEW_STRING("engine"), args.This());
+		req->obj_->Set(NEW_STRING("inputs"), args[0]);
+		req->obj_->Set(NEW_STRING("md5"), args[2]);
+#endif
+		
+		AsyncStart(req);
+		if(calcMd5)
+			ppgf_parallel_submit((numInputs + md5_multi_num-1) / md5_multi_num, &finish_md5_item, req, &AsyncDone, req);
+		else if(numInputs)
+			ppgf_finish_input(engine->engine, numInputs, inputs, bufLen, &AsyncDone, req);
+		else
+			AsyncDone(req);
+	} else {
+		if(calcMd5)
+			ppgf_parallel_run((numInputs + md5_multi_num-1) / md5_multi_num, &finish_md5_item, req);
+		else
+			ppgf_finish_input(engine->engine, numInputs, inputs, bufLen, NULL, NULL);
+		delete req;
 	}
-	
-	delete[] inputs;
 	RETURN_UNDEF
 }
 
@@ -555,31 +869,12 @@ FUNC(MD5Update2) {
 		RETURN_ERROR("Invalid MD5 context data");
 	
 	
-	// TODO: test 2 buffer update methods
-	
-	MD5_CTX *md5[MD5_SIMD_NUM];
-	char* inputs[MD5_SIMD_NUM];
-	
-#if MD5_SIMD_NUM == 1
-	inputs[0] = node::Buffer::Data(args[2]);
-	size_t len = node::Buffer::Length(args[2]);
-	md5[0] = (MD5_CTX*)node::Buffer::Data(args[0]);
-	md5_multi_update(md5, (const void**)inputs, len);
-	
-	md5[0] = (MD5_CTX*)node::Buffer::Data(args[1]);
-	md5_multi_update(md5, (const void**)inputs, len);
-#else
-	MD5_CTX dummyMd5;
-	for(unsigned int i=0; i<MD5_SIMD_NUM; i++) {
-		md5[i] = &dummyMd5;
-		inputs[i] = node::Buffer::Data(args[2]);
-	}
-	md5[0] = (MD5_CTX*)node::Buffer::Data(args[0]);
-	md5[1] = (MD5_CTX*)node::Buffer::Data(args[1]);
-	dummyMd5.dataLen = md5[0]->dataLen;
-	
-	md5_multi_update(md5, (const void**)inputs, node::Buffer::Length(args[2]));
-#endif
+	md5_update2(
+		(MD5_CTX*)node::Buffer::Data(args[0]),
+		(MD5_CTX*)node::Buffer::Data(args[1]),
+		node::Buffer::Data(args[2]),
+		node::Buffer::Length(args[2])
+	);
 	
 	RETURN_UNDEF
 }
@@ -620,15 +915,401 @@ FUNC(MD5UpdateZeroes) {
 	RETURN_UNDEF
 }
 
+static inline uint32_t crc32_read(const char* buf) {
+	// CRCs are passed around as 4 byte big-endian Buffers
+	const uint8_t* b = (const uint8_t*)buf;
+	return ((uint32_t)b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+}
+static inline void crc32_write(char* buf, uint32_t crc) {
+	uint8_t* b = (uint8_t*)buf;
+	b[0] = crc >> 24;
+	b[1] = (crc >> 16) & 0xff;
+	b[2] = (crc >> 8) & 0xff;
+	b[3] = crc & 0xff;
+}
+
+// crc32(Buffer data [, Buffer initialCrc])
+FUNC(CRC32) {
+	FUNC_START;
+	
+	if (args.Length() < 1 || !node::Buffer::HasInstance(args[0]))
+		RETURN_ERROR("First argument must be a Buffer");
+	
+	uint32_t crc = 0;
+	if (args.Length() >= 2 && !args[1]->IsUndefined()) {
+		if (!node::Buffer::HasInstance(args[1]) || node::Buffer::Length(args[1]) != 4)
+			RETURN_ERROR("Second argument must be a 4 byte Buffer");
+		crc = crc32_read(node::Buffer::Data(args[1]));
+	}
+	
+	crc = crc32_calc(node::Buffer::Data(args[0]), node::Buffer::Length(args[0]), crc);
+	
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Object> ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), crc);
+	RETURN_VAL(ret);
+#else
+	node::Buffer* ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), crc);
+	RETURN_VAL(ret->handle_);
+#endif
+}
+
+// crc32_zeroes(Buffer crc, int length): returns crc extended by `length` zero bytes
+FUNC(CRC32Zeroes) {
+	FUNC_START;
+	
+	if (args.Length() < 2)
+		RETURN_ERROR("2 arguments required");
+	if (!node::Buffer::HasInstance(args[0]) || node::Buffer::Length(args[0]) != 4)
+		RETURN_ERROR("First argument must be a 4 byte Buffer");
+	
+#if NODE_VERSION_AT_LEAST(8, 0, 0)
+	double len = args[1].As<Number>()->Value();
+#else
+	double len = args[1]->NumberValue();
+#endif
+	if (len < 0)
+		RETURN_ERROR("Invalid length");
+	uint32_t crc = crc32_zeroes(crc32_read(node::Buffer::Data(args[0])), (uint64_t)len);
+	
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Object> ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), crc);
+	RETURN_VAL(ret);
+#else
+	node::Buffer* ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), crc);
+	RETURN_VAL(ret->handle_);
+#endif
+}
+
+struct ingest_state {
+	MD5_CTX* md5[2];
+	uint32_t crc;
+};
+static void ingest_visit(void* arg, const void* data, size_t len) {
+	struct ingest_state* state = (struct ingest_state*)arg;
+	md5_update2(state->md5[0], state->md5[1], data, len);
+	state->crc = crc32_calc(data, len, state->crc);
+}
+
+// ingest_packed(Buffer input, Buffer dest, int sliceLen, int inputNum, int packSize, Buffer md5ctx1, Buffer md5ctx2)
+// does the same as copy_packed, whilst also updating both MD5 contexts with, and returning the CRC32 of, the input, in a single pass over it
+FUNC(IngestPacked) {
+	FUNC_START;
+	GET_ENGINE;
+	
+	if (args.Length() < 7 || !node::Buffer::HasInstance(args[0]) || !node::Buffer::HasInstance(args[1]) || !node::Buffer::HasInstance(args[5]) || !node::Buffer::HasInstance(args[6]))
+		RETURN_ERROR("Two Buffers, three integers and two MD5 contexts required");
+	
+	size_t destLen = node::Buffer::Length(args[1]),
+		inputLen = node::Buffer::Length(args[0]);
+	char* dest = node::Buffer::Data(args[1]);
+	const char* src = node::Buffer::Data(args[0]);
+	size_t sliceLen = (size_t)ARG_TO_INT(args[2]);
+	int inputNum = ARG_TO_INT(args[3]);
+	int packSize = ARG_TO_INT(args[4]);
+	
+	if((uintptr_t)dest & (engine->memAlign-1))
+		RETURN_ERROR("Destination not aligned");
+	if(!sliceLen || (sliceLen & (engine->memStride-1)) != 0)
+		RETURN_ERROR("Slice length must be a multiple of stride");
+	if(inputLen > sliceLen)
+		RETURN_ERROR("Input larger than slice length");
+	if(packSize < 1 || packSize > 65536 || inputNum < 0 || inputNum >= packSize)
+		RETURN_ERROR("Invalid input number or pack size");
+	if(sliceLen * packSize > destLen)
+		RETURN_ERROR("Destination not large enough to hold inputs");
+	
+	if(node::Buffer::Length(args[5]) != sizeof(MD5_CTX) || node::Buffer::Length(args[6]) != sizeof(MD5_CTX))
+		RETURN_ERROR("Invalid MD5 context length");
+	struct ingest_state state;
+	state.md5[0] = (MD5_CTX*)node::Buffer::Data(args[5]);
+	state.md5[1] = (MD5_CTX*)node::Buffer::Data(args[6]);
+	state.crc = 0;
+	if(state.md5[0]->dataLen > MD5_BLOCKSIZE || state.md5[1]->dataLen > MD5_BLOCKSIZE)
+		RETURN_ERROR("Invalid MD5 context data");
+	
+	ppgf_prep_input_packed_visit(engine->engine, sliceLen, inputLen, dest, src, inputNum, packSize, &ingest_visit, &state);
+	
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Object> ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), state.crc);
+	RETURN_VAL(ret);
+#else
+	node::Buffer* ret = BUFFER_NEW(4);
+	crc32_write(node::Buffer::Data(ret), state.crc);
+	RETURN_VAL(ret->handle_);
+#endif
+}
+
+// batched MD5 hashing on the hashing thread pool (separate from the one used for GF computation)
+// every buffer submitted for the same context forms a stream, which must be hashed in order; streams are independent, so are spread across threads and packed into the lanes of the multi-buffer hasher
+// buffers can also have their CRC32 computed, which is done alongside the MD5, whilst the data is in cache
+struct MD5Segment {
+	const char* data;
+	size_t len;
+	char* crc; // if non-NULL, receives the CRC32 of the segment
+};
+struct MD5Stream {
+	MD5_CTX* md5;
+	unsigned first, count; // range of segments
+	uint64_t total; // bytes across all segments
+};
+struct MD5BatchRequest : public AsyncRequest {
+	std::vector<MD5Segment> segments; // grouped by stream, in submission order
+	std::vector<MD5Stream> streams; // grouped by item
+	std::vector<unsigned> itemStreams; // item N processes streams [itemStreams[N], itemStreams[N+1])
+};
+
+static bool md5_stream_larger(const MD5Stream& a, const MD5Stream& b) {
+	return a.total > b.total;
+}
+
+// distribute streams across (up to) numItems items, balancing the amount of data each has to hash
+static void md5_batch_assign(MD5BatchRequest* req, unsigned numItems) {
+	std::vector<MD5Stream>& streams = req->streams;
+	if(numItems > streams.size()) numItems = (unsigned)streams.size();
+	
+	// largest first, always to the least loaded item
+	std::stable_sort(streams.begin(), streams.end(), md5_stream_larger);
+	std::vector<uint64_t> load(numItems, 0);
+	std::vector<std::vector<MD5Stream> > items(numItems);
+	for(unsigned i = 0; i < streams.size(); i++) {
+		unsigned target = 0;
+		for(unsigned item = 1; item < numItems; item++)
+			if(load[item] < load[target]) target = item;
+		load[target] += streams[i].total;
+		items[target].push_back(streams[i]);
+	}
+	
+	streams.clear();
+	req->itemStreams.clear();
+	for(unsigned item = 0; item < numItems; item++) {
+		req->itemStreams.push_back((unsigned)streams.size());
+		streams.insert(streams.end(), items[item].begin(), items[item].end());
+	}
+	req->itemStreams.push_back((unsigned)streams.size());
+}
+
+struct md5_batch_lane {
+	const MD5Stream* stream;
+	unsigned segment;
+	size_t pos;
+	uint32_t crc; // of the current segment, up to pos
+};
+// move the lane to its stream's next non-empty segment, writing out the CRC of any segments completed; returns false once the stream is done
+static inline bool md5_batch_lane_next(const MD5BatchRequest& req, md5_batch_lane& lane) {
+	while(lane.segment < lane.stream->first + lane.stream->count) {
+		const MD5Segment& segment = req.segments[lane.segment];
+		if(lane.pos < segment.len) return true;
+		if(segment.crc) crc32_write(segment.crc, lane.crc);
+		lane.segment++;
+		lane.pos = 0;
+		lane.crc = 0;
+	}
+	return false;
+}
+
+// each lane hashes one stream at a time; as streams complete, lanes are refilled with the item's remaining streams
+static void md5_batch_item(void* arg, unsigned int item, unsigned int) {
+	const MD5BatchRequest& req = *(const MD5BatchRequest*)arg;
+	const MD5Stream* nextStream = &req.streams[0] + req.itemStreams[item];
+	const MD5Stream* endStream = &req.streams[0] + req.itemStreams[item+1];
+	
+	md5_batch_lane lanes[MD5_SIMD_MAX_NUM];
+	unsigned numLanes = 0;
+	MD5_CTX dummy;
+	md5_init(&dummy);
+	MD5_CTX* md5[MD5_SIMD_MAX_NUM];
+	const void* data[MD5_SIMD_MAX_NUM];
+	
+	while(1) {
+		while(numLanes < md5_multi_num && nextStream != endStream) {
+			md5_batch_lane& lane = lanes[numLanes];
+			lane.stream = nextStream++;
+			lane.segment = lane.stream->first;
+			lane.pos = 0;
+			lane.crc = 0;
+			if(md5_batch_lane_next(req, lane)) numLanes++;
+		}
+		if(!numLanes) break;
+		
+		// all lanes are advanced by the same amount, so the step is limited by the segment closest to its end
+		size_t len = ~(size_t)0;
+		for(unsigned i = 0; i < numLanes; i++) {
+			size_t remaining = req.segments[lanes[i].segment].len - lanes[i].pos;
+			if(remaining < len) len = remaining;
+			md5[i] = lanes[i].stream->md5;
+			data[i] = req.segments[lanes[i].segment].data + lanes[i].pos;
+		}
+		
+		// a call to the full multi-buffer kernel costs about as much as md5_multi_num/8 calls to the two-stream one (measured: the 32 buffer AVX512 kernel overtakes pairs at 5 lanes, the 16 buffer AVX2 kernel at 3), so pairs are used below that
+		dummy.dataLen = 0;
+		if(numLanes <= 2 || numLanes*8 <= md5_multi_num) {
+			unsigned i = 0;
+			for(; i+1 < numLanes; i += 2)
+				md5_update2x(md5[i], md5[i+1], data[i], data[i+1], len);
+			if(i < numLanes)
+				md5_update2x(md5[i], &dummy, data[i], data[i], len);
+		} else {
+			for(unsigned i = numLanes; i < md5_multi_num; i++) {
+				md5[i] = &dummy;
+				data[i] = data[0];
+			}
+			md5_multi_update(md5, data, len);
+		}
+		
+		for(unsigned i = 0; i < numLanes; ) {
+			const MD5Segment& segment = req.segments[lanes[i].segment];
+			if(segment.crc)
+				lanes[i].crc = crc32_calc(segment.data + lanes[i].pos, len, lanes[i].crc);
+			lanes[i].pos += len;
+			if(md5_batch_lane_next(req, lanes[i]))
+				i++;
+			else
+				lanes[i] = lanes[--numLanes];
+		}
+	}
+}
+
+// md5_update_batch(Array md5ctxs, Array data [, Function cb [, Array crcs]])
+// updates md5ctxs[i] with data[i] for all i; where the same context appears more than once, its data is hashed in the order given
+// if cb is supplied, hashing is performed on the hashing thread pool and cb is called once done, otherwise it is performed on the calling thread
+// if crcs is supplied, each non-null crcs[i] must be a 4 byte Buffer, which receives the CRC32 of data[i]
+FUNC(MD5UpdateBatch) {
+	FUNC_START;
+	
+	if (args.Length() < 2 || !args[0]->IsArray() || !args[1]->IsArray())
+		RETURN_ERROR("Arrays of MD5 contexts and data required");
+	
+	bool async = args.Length() >= 3 && args[2]->IsFunction();
+	unsigned int num = Local<Array>::Cast(args[0])->Length();
+	if (Local<Array>::Cast(args[1])->Length() != num)
+		RETURN_ERROR("Number of MD5 contexts doesn't equal number of buffers");
+	bool hasCrcs = args.Length() >= 4 && !args[3]->IsUndefined() && !args[3]->IsNull();
+	if (hasCrcs && (!args[3]->IsArray() || Local<Array>::Cast(args[3])->Length() != num))
+		RETURN_ERROR("Number of CRC32 outputs doesn't equal number of buffers");
+	
+	MD5BatchRequest* req = new MD5BatchRequest();
+	req->engine = NULL;
+	
+	#define RTN_ERROR(m) { \
+		delete req; \
+		RETURN_ERROR(m); \
+	}
+	
+	Local<Object> oMd5 = ARG_TO_OBJ(args[0]);
+	Local<Object> oData = ARG_TO_OBJ(args[1]);
+	Local<Object> oCrc;
+	if(hasCrcs) oCrc = ARG_TO_OBJ(args[3]);
+	std::map<MD5_CTX*, unsigned> streamIndex;
+	std::vector<unsigned> segStream(num);
+	std::vector<MD5Segment> segs(num);
+	for(unsigned int i = 0; i < num; i++) {
+		Local<Value> md5Ctx = GET_ARR(oMd5, i);
+		Local<Value> data = GET_ARR(oData, i);
+		if (!node::Buffer::HasInstance(md5Ctx) || node::Buffer::Length(md5Ctx) != sizeof(MD5_CTX))
+			RTN_ERROR("Invalid MD5 contexts provided");
+		MD5_CTX* md5 = (MD5_CTX*)node::Buffer::Data(md5Ctx);
+		if(md5->dataLen > MD5_BLOCKSIZE)
+			RTN_ERROR("Invalid MD5 contexts provided");
+		if (!node::Buffer::HasInstance(data))
+			RTN_ERROR("All data must be Buffers");
+		segs[i].data = node::Buffer::Data(data);
+		segs[i].len = node::Buffer::Length(data);
+		segs[i].crc = NULL;
+		if(hasCrcs) {
+			Local<Value> crc = GET_ARR(oCrc, i);
+			if(!crc->IsUndefined() && !crc->IsNull()) {
+				if (!node::Buffer::HasInstance(crc) || node::Buffer::Length(crc) != 4)
+					RTN_ERROR("CRC32 outputs must be 4 byte Buffers");
+				segs[i].crc = node::Buffer::Data(crc);
+			}
+		}
+		
+		std::map<MD5_CTX*, unsigned>::iterator it = streamIndex.find(md5);
+		if(it == streamIndex.end()) {
+			MD5Stream stream;
+			stream.md5 = md5;
+			stream.first = 0;
+			stream.count = 0;
+			stream.total = 0;
+			it = streamIndex.insert(std::make_pair(md5, (unsigned)req->streams.size())).first;
+			req->streams.push_back(stream);
+		}
+		MD5Stream& stream = req->streams[it->second];
+		stream.count++;
+		stream.total += segs[i].len;
+		segStream[i] = it->second;
+	}
+	#undef RTN_ERROR
+	
+	// lay out segments contiguously per stream, retaining their order
+	unsigned pos = 0;
+	for(unsigned int i = 0; i < req->streams.size(); i++) {
+		req->streams[i].first = pos;
+		pos += req->streams[i].count;
+		req->streams[i].count = 0;
+	}
+	req->segments.resize(num);
+	for(unsigned int i = 0; i < num; i++) {
+		MD5Stream& stream = req->streams[segStream[i]];
+		req->segments[stream.first + stream.count++] = segs[i];
+	}
+	
+	md5_batch_assign(req, async ? ppgf_get_num_threads() : 1);
+	unsigned numItems = (unsigned)req->itemStreams.size() - 1;
+	
+	if (async) {
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+		req->isolate = isolate;
+		Local<Object> obj = Object::New(isolate);
+		SET_OBJ(obj, "ondone", args[2]);
+		// keep the buffers referenced until the job completes
+		SET_OBJ(obj, "md5", args[0]);
+		SET_OBJ(obj, "data", args[1]);
+		if(hasCrcs) SET_OBJ(obj, "crcs", args[3]);
+		req->obj_.Reset(ISOLATE obj);
+#else
+		req->obj_ = Persistent<Object>::New(ISOLATE Object::New());
+		req->obj_->Set(NEW_STRING("ondone"), args[2]);
+		req->obj_->Set(NEW_STRING("md5"), args[0]);
+		req->obj_->Set(NEW_STRING("data"), args[1]);
+		if(hasCrcs) req->obj_->Set(NEW_STRING("crcs"), args[3]);
+#endif
+		
+		AsyncStart(req);
+		if(numItems)
+			ppgf_hash_submit(numItems, &md5_batch_item, req, &AsyncDone, req);
+		else
+			AsyncDone(req);
+	} else {
+		for(unsigned int item = 0; item < numItems; item++)
+			md5_batch_item(req, item, 0);
+		delete req;
+	}
+	RETURN_UNDEF
+}
+
 FUNC(SetMethod) {
 	FUNC_START;
+	GET_ENGINE;
 	
-	if (mmActiveTasks)
+	if (engine->activeTasks)
 		RETURN_ERROR("Calculation already in progress");
 	
+	int sizeHint = args.Length() >= 2 ? ARG_TO_INT(args[1]) : 0;
+	int chunkSizeOverride = args.Length() >= 3 && !args[2]->IsUndefined() ? ARG_TO_INT(args[2]) : 0;
+	if(chunkSizeOverride < 0)
+		RETURN_ERROR("Invalid chunk size");
 	if(ppgf_set_method(
+		engine->engine,
 		args.Length() >= 1 && !args[0]->IsUndefined() ? ARG_TO_INT(args[0]) : 0 /*GF16_AUTO*/,
-		args.Length() >= 2 ? ARG_TO_INT(args[1]) : 0
+		sizeHint,
+		chunkSizeOverride,
+		args.Length() >= 4 && !args[3]->IsUndefined() ? ARG_TO_INT(args[3]) : -1
 	))
 		RETURN_ERROR("Unknown method specified");
 	
@@ -641,17 +1322,74 @@ FUNC(SetMethod) {
 	
 	int rMethod;
 	const char* rMethLong;
-	ppgf_get_method(&rMethod, &rMethLong, &MEM_ALIGN, &MEM_STRIDE);
+	ppgf_get_method(engine->engine, &rMethod, &rMethLong, &engine->memAlign, &engine->memStride);
 	
-	SET_OBJ(ret, "alignment", Integer::New(ISOLATE MEM_ALIGN));
-	SET_OBJ(ret, "stride", Integer::New(ISOLATE MEM_STRIDE));
+	SET_OBJ(ret, "alignment", Integer::New(ISOLATE engine->memAlign));
+	SET_OBJ(ret, "stride", Integer::New(ISOLATE engine->memStride));
 	SET_OBJ(ret, "method", Integer::New(ISOLATE rMethod));
 	SET_OBJ(ret, "method_desc", NEW_STRING(rMethLong));
 	
+	// detected cache topology, and the processing sizes derived from it
+	size_t cacheSizes[3], chunkSize, tileSize;
+	unsigned cacheShares[3];
+	ppgf_get_cache_info(engine->engine, cacheSizes, cacheShares, &chunkSize, &tileSize, sizeHint > 0 ? sizeHint : 0);
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Object> cache = Object::New(isolate);
+#else
+	Local<Object> cache = Object::New();
+#endif
+	SET_OBJ(cache, "l1d", Number::New(ISOLATE (double)cacheSizes[0]));
+	SET_OBJ(cache, "l2", Number::New(ISOLATE (double)cacheSizes[1]));
+	SET_OBJ(cache, "l3", Number::New(ISOLATE (double)cacheSizes[2]));
+	SET_OBJ(cache, "l1d_shared", Integer::New(ISOLATE cacheShares[0]));
+	SET_OBJ(cache, "l2_shared", Integer::New(ISOLATE cacheShares[1]));
+	SET_OBJ(cache, "l3_shared", Integer::New(ISOLATE cacheShares[2]));
+	SET_OBJ(ret, "cache", cache);
+	if(sizeHint > 0)
+		SET_OBJ(ret, "chunk_size", Number::New(ISOLATE (double)chunkSize));
+	SET_OBJ(ret, "tile_size", Number::New(ISOLATE (double)tileSize));
 	
 	RETURN_VAL(ret);
 }
 
+FUNC(GetAvailableMethods) {
+	FUNC_START;
+	int methods[64];
+	unsigned num = ppgf_get_available_methods(methods, 64);
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Array> ret = Array::New(isolate, num);
+#else
+	Local<Array> ret = Array::New(num);
+#endif
+	for(unsigned i=0; i<num; i++)
+		SET_ARR(ret, i, Integer::New(ISOLATE methods[i]));
+	RETURN_VAL(ret);
+}
+
+FUNC(GetNumMethods) {
+	FUNC_START;
+	RETURN_VAL(Integer::New(ISOLATE ppgf_get_num_methods()));
+}
+
+FUNC(GetXorJitMethods) {
+	FUNC_START;
+	int methods[16];
+	unsigned num = ppgf_get_xor_jit_methods(methods, 16);
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Local<Array> ret = Array::New(isolate, num);
+#else
+	Local<Array> ret = Array::New(num);
+#endif
+	for(unsigned i=0; i<num; i++)
+		SET_ARR(ret, i, Integer::New(ISOLATE methods[i]));
+	RETURN_VAL(ret);
+}
+
+FUNC(GetCpuSignature) {
+	FUNC_START;
+	RETURN_VAL(NEW_STRING(ppgf_get_cpu_signature()));
+}
+
 
 void parpar_gf_init(
 #if NODE_VERSION_AT_LEAST(4, 0, 0)
@@ -664,15 +1402,17 @@ void parpar_gf_init(
 ) {
 	ppgf_init_constants();
 	ppgf_init_gf_module();
-	
-	int rMethod;
-	const char* rMethLong;
-	ppgf_get_method(&rMethod, &rMethLong, &MEM_ALIGN, &MEM_STRIDE);
+	md5_multi_init();
+	crc32_init();
+	defaultEngine = new GfEngine();
 	
 	NODE_SET_METHOD(target, "md5_init", MD5Start);
 	NODE_SET_METHOD(target, "md5_final", MD5Finish);
 	NODE_SET_METHOD(target, "md5_update2", MD5Update2);
 	NODE_SET_METHOD(target, "md5_update_zeroes", MD5UpdateZeroes);
+	NODE_SET_METHOD(target, "md5_update_batch", MD5UpdateBatch);
+	NODE_SET_METHOD(target, "crc32", CRC32);
+	NODE_SET_METHOD(target, "crc32_zeroes", CRC32Zeroes);
 	
 	// generate(Buffer input, int inputBlockNum, Array<Buffer> outputs, Array<int> recoveryBlockNums [, bool add [, Function callback]])
 	// ** DON'T modify buffers whilst function is running! **
@@ -681,15 +1421,60 @@ void parpar_gf_init(
 	NODE_SET_METHOD(target, "alignment_offset", AlignmentOffset);
 	
 	NODE_SET_METHOD(target, "copy", PrepInput);
+	
+	// copy_packed(Buffer input, Buffer dest, int sliceLen, int inputNum, int packSize)
+	NODE_SET_METHOD(target, "copy_packed", PrepInputPacked);
+	// ingest_packed(Buffer input, Buffer dest, int sliceLen, int inputNum, int packSize, Buffer md5ctx1, Buffer md5ctx2): returns the input's CRC32
+	NODE_SET_METHOD(target, "ingest_packed", IngestPacked);
+	// generate_packed(Buffer input, int sliceLen, int packSize, Array<int> inputBlockNums, Array<Buffer> outputs, Array<int> recoveryBlockNums [, bool add [, Function callback]])
+	// input must have been filled via copy_packed, using the same sliceLen and packSize
+	NODE_SET_METHOD(target, "generate_packed", MultiplyPacked);
+	// finish(Array<Buffer> outputs, int len [, Array<Buffer> md5Contexts [, Function callback]])
+	// converts outputs to their final form, and optionally updates their MD5; runs in the background if a callback is given
 	NODE_SET_METHOD(target, "finish", Finish);
 	
-#ifdef _OPENMP
 	// set_max_threads(int num_threads)
 	NODE_SET_METHOD(target, "set_max_threads", SetMaxThreads);
-#endif
 	NODE_SET_METHOD(target, "get_num_threads", GetNumThreads);
+	// set_tiling(bool enable): whether to process inputs in cache sized tiles; mostly useful for benchmarking
+	NODE_SET_METHOD(target, "set_tiling", SetTiling);
 	
+	// set_method([int method [, int sizeHint [, int chunkSize [, int jitStrategy]]]])
 	NODE_SET_METHOD(target, "set_method", SetMethod);
+	// Array<int> available_methods(): methods supported by the CPU
+	NODE_SET_METHOD(target, "available_methods", GetAvailableMethods);
+	// int num_methods(): method IDs range from 0 (auto) to num_methods()-1
+	NODE_SET_METHOD(target, "num_methods", GetNumMethods);
+	// Array<int> xor_jit_methods(): methods which accept a jitStrategy in set_method
+	NODE_SET_METHOD(target, "xor_jit_methods", GetXorJitMethods);
+	// string cpu_signature(): identifies the CPU, for associating tuning results with it
+	NODE_SET_METHOD(target, "cpu_signature", GetCpuSignature);
+	
+	// new Engine(): an independent GF engine, supporting the same methods as the module that relate to GF processing
+	// the module level methods operate on a default engine; different engines can have jobs running concurrently
+#if NODE_VERSION_AT_LEAST(0, 11, 0)
+	Isolate* isolate = Isolate::GetCurrent();
+	Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, EngineNew);
+	engineTemplate.Reset(isolate, tpl);
+#else
+	Local<FunctionTemplate> tpl = FunctionTemplate::New(EngineNew);
+	engineTemplate = Persistent<FunctionTemplate>::New(tpl);
+#endif
+	tpl->SetClassName(NEW_STRING("Engine"));
+	tpl->InstanceTemplate()->SetInternalFieldCount(1);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "set_method", SetMethod);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "alignment_offset", AlignmentOffset);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "copy", PrepInput);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "copy_packed", PrepInputPacked);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "ingest_packed", IngestPacked);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "generate", MultiplyMulti);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "generate_packed", MultiplyPacked);
+	NODE_SET_PROTOTYPE_METHOD(tpl, "finish", Finish);
+#if NODE_VERSION_AT_LEAST(12, 0, 0)
+	SET_OBJ(target, "Engine", tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
+#else
+	SET_OBJ(target, "Engine", tpl->GetFunction());
+#endif
 }
 
 NODE_MODULE(parpar_gf, parpar_gf_init);
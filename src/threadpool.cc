@@ -0,0 +1,231 @@
+#include "threadpool.h"
+#if defined(__linux__)
+# include <sched.h>
+#elif defined(_WIN32)
+# include <windows.h>
+#endif
+
+ThreadPool::ThreadPool(unsigned numThreads) : _numThreads(0), generation(0), exiting(false), activeJobs(0) {
+	uv_mutex_init(&wakeMutex);
+	uv_cond_init(&wakeCond);
+	uv_mutex_init(&jobsMutex);
+	uv_cond_init(&jobsCond);
+	setNumThreads(numThreads);
+}
+
+ThreadPool::~ThreadPool() {
+	setNumThreads(0); // wait for jobs to finish
+	stopWorkers();
+	uv_cond_destroy(&jobsCond);
+	uv_mutex_destroy(&jobsMutex);
+	uv_cond_destroy(&wakeCond);
+	uv_mutex_destroy(&wakeMutex);
+}
+
+unsigned ThreadPool::hardwareThreads() {
+	// prefer the number of CPUs this process may actually run on (respects affinity masks)
+#if UV_VERSION_MAJOR > 1 || (UV_VERSION_MAJOR == 1 && UV_VERSION_MINOR >= 44)
+	return uv_available_parallelism();
+#else
+# if defined(__linux__) && defined(CPU_COUNT)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	if(sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0) {
+		int count = CPU_COUNT(&cpuSet);
+		if(count > 0) return (unsigned)count;
+	}
+# elif defined(_WIN32)
+	DWORD_PTR procMask, sysMask;
+	if(GetProcessAffinityMask(GetCurrentProcess(), &procMask, &sysMask)) {
+		unsigned count = 0;
+		for(; procMask; procMask &= procMask-1)
+			count++;
+		if(count > 0) return count;
+	}
+# endif
+	uv_cpu_info_t* cpuInfo;
+	int count;
+	if(uv_cpu_info(&cpuInfo, &count) != 0)
+		return 1;
+	uv_free_cpu_info(cpuInfo, count);
+	return count > 0 ? (unsigned)count : 1;
+#endif
+}
+
+void ThreadPool::setNumThreads(unsigned numThreads) {
+	if(numThreads < 1) numThreads = hardwareThreads();
+	uv_mutex_lock(&jobsMutex);
+	while(activeJobs)
+		uv_cond_wait(&jobsCond, &jobsMutex);
+	if(numThreads != _numThreads) {
+		// workers are started lazily, on the first job
+		stopWorkers();
+		_numThreads = numThreads;
+	}
+	uv_mutex_unlock(&jobsMutex);
+}
+
+void ThreadPool::startWorkers() {
+	exiting = false;
+	workers.reserve(_numThreads);
+	for(unsigned i=0; i<_numThreads; i++) {
+		Worker* worker = new Worker;
+		worker->pool = this;
+		worker->num = i;
+		uv_mutex_init(&worker->mutex);
+		workers.push_back(worker);
+	}
+	for(unsigned i=0; i<_numThreads; i++)
+		uv_thread_create(&workers[i]->thread, &ThreadPool::workerThread, workers[i]);
+}
+
+void ThreadPool::stopWorkers() {
+	if(workers.empty()) return;
+	uv_mutex_lock(&wakeMutex);
+	exiting = true;
+	uv_cond_broadcast(&wakeCond);
+	uv_mutex_unlock(&wakeMutex);
+	// all workers must exit before any are cleaned up, as they may look in each others' queues
+	for(unsigned i=0; i<workers.size(); i++)
+		uv_thread_join(&workers[i]->thread);
+	for(unsigned i=0; i<workers.size(); i++) {
+		uv_mutex_destroy(&workers[i]->mutex);
+		delete workers[i];
+	}
+	workers.clear();
+}
+
+// takes the next task from the worker's own queue, otherwise tries to steal one from another worker
+bool ThreadPool::getTask(Worker* worker, Task& task) {
+	uv_mutex_lock(&worker->mutex);
+	if(!worker->tasks.empty()) {
+		task = worker->tasks.front();
+		worker->tasks.pop_front();
+		uv_mutex_unlock(&worker->mutex);
+		return true;
+	}
+	uv_mutex_unlock(&worker->mutex);
+	
+	unsigned numWorkers = (unsigned)workers.size();
+	for(unsigned i=1; i<numWorkers; i++) {
+		Worker* victim = workers[(worker->num + i) % numWorkers];
+		uv_mutex_lock(&victim->mutex);
+		if(!victim->tasks.empty()) {
+			task = victim->tasks.back();
+			victim->tasks.pop_back();
+			uv_mutex_unlock(&victim->mutex);
+			return true;
+		}
+		uv_mutex_unlock(&victim->mutex);
+	}
+	return false;
+}
+
+void ThreadPool::workerThread(void* arg) {
+	Worker* worker = static_cast<Worker*>(arg);
+	ThreadPool* pool = worker->pool;
+	while(1) {
+		// note the generation before looking for tasks, so that any tasks added after this will prevent us from sleeping
+		uv_mutex_lock(&pool->wakeMutex);
+		unsigned seenGeneration = pool->generation;
+		uv_mutex_unlock(&pool->wakeMutex);
+		
+		Task task;
+		while(pool->getTask(worker, task)) {
+			task.job->func(task.job->arg, task.item, worker->num);
+			pool->completeTask(task.job);
+		}
+		
+		uv_mutex_lock(&pool->wakeMutex);
+		while(pool->generation == seenGeneration && !pool->exiting)
+			uv_cond_wait(&pool->wakeCond, &pool->wakeMutex);
+		bool exiting = pool->exiting;
+		uv_mutex_unlock(&pool->wakeMutex);
+		if(exiting) break;
+	}
+}
+
+void ThreadPool::completeTask(Job* job) {
+	uv_mutex_lock(&job->mutex);
+	bool last = (--job->remaining == 0);
+	uv_mutex_unlock(&job->mutex);
+	if(!last) return;
+	
+	job->done(job->doneArg);
+	uv_mutex_destroy(&job->mutex);
+	delete job;
+	
+	uv_mutex_lock(&jobsMutex);
+	if(--activeJobs == 0)
+		uv_cond_broadcast(&jobsCond);
+	uv_mutex_unlock(&jobsMutex);
+}
+
+void ThreadPool::submit(unsigned numItems, TaskFunc func, void* arg, DoneFunc done, void* doneArg) {
+	if(!numItems) {
+		done(doneArg);
+		return;
+	}
+	uv_mutex_lock(&jobsMutex);
+	if(workers.empty())
+		startWorkers();
+	activeJobs++;
+	uv_mutex_unlock(&jobsMutex);
+	
+	Job* job = new Job;
+	job->func = func;
+	job->arg = arg;
+	job->done = done;
+	job->doneArg = doneArg;
+	job->remaining = numItems;
+	uv_mutex_init(&job->mutex);
+	
+	// give each worker a contiguous range of items, so that neighbouring items (which typically share data) are processed by the same thread
+	unsigned numWorkers = (unsigned)workers.size();
+	for(unsigned w=0; w<numWorkers; w++) {
+		unsigned start = (unsigned)((unsigned long long)numItems * w / numWorkers);
+		unsigned end = (unsigned)((unsigned long long)numItems * (w+1) / numWorkers);
+		if(start == end) continue;
+		Worker* worker = workers[w];
+		uv_mutex_lock(&worker->mutex);
+		for(unsigned item=start; item<end; item++) {
+			Task task = {job, item};
+			worker->tasks.push_back(task);
+		}
+		uv_mutex_unlock(&worker->mutex);
+	}
+	
+	uv_mutex_lock(&wakeMutex);
+	generation++;
+	uv_cond_broadcast(&wakeCond);
+	uv_mutex_unlock(&wakeMutex);
+}
+
+struct ThreadPoolSyncWait {
+	uv_mutex_t mutex;
+	uv_cond_t cond;
+	bool done;
+};
+static void sync_job_done(void* arg) {
+	ThreadPoolSyncWait* wait = static_cast<ThreadPoolSyncWait*>(arg);
+	uv_mutex_lock(&wait->mutex);
+	wait->done = true;
+	uv_cond_signal(&wait->cond);
+	uv_mutex_unlock(&wait->mutex);
+}
+
+void ThreadPool::run(unsigned numItems, TaskFunc func, void* arg) {
+	ThreadPoolSyncWait wait;
+	wait.done = false;
+	uv_mutex_init(&wait.mutex);
+	uv_cond_init(&wait.cond);
+	
+	submit(numItems, func, arg, &sync_job_done, &wait);
+	
+	uv_mutex_lock(&wait.mutex);
+	while(!wait.done)
+		uv_cond_wait(&wait.cond, &wait.mutex);
+	uv_mutex_unlock(&wait.mutex);
+	uv_cond_destroy(&wait.cond);
+	uv_mutex_destroy(&wait.mutex);
+}
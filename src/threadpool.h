@@ -0,0 +1,80 @@
+#ifndef __PARPAR_THREADPOOL_H
+#define __PARPAR_THREADPOOL_H
+
+#include <uv.h>
+#include <deque>
+#include <vector>
+
+// persistent pool of worker threads, used for all parallel processing
+// a job consists of a number of items, which are split across the workers' queues in contiguous ranges; workers process their own queue in order, and steal from the back of others' queues once theirs is empty
+// multiple jobs can be in flight at once (e.g. from different GF engines), in which case their items are interleaved in the queues
+class ThreadPool {
+public:
+	// called for each item of a job; threadNum is the index (0 to numThreads-1) of the worker running it, which can be used to select per-thread resources
+	// a worker only ever runs one item at a time, so per-thread resources can be shared across concurrent jobs
+	typedef void(*TaskFunc)(void* arg, unsigned item, unsigned threadNum);
+	// called once all items of a job are complete, from the worker thread which completed the last item
+	typedef void(*DoneFunc)(void* arg);
+
+private:
+	struct Job {
+		TaskFunc func;
+		void* arg;
+		DoneFunc done;
+		void* doneArg;
+		unsigned remaining;
+		uv_mutex_t mutex;
+	};
+	struct Task {
+		Job* job;
+		unsigned item;
+	};
+	struct Worker {
+		ThreadPool* pool;
+		unsigned num;
+		uv_thread_t thread;
+		uv_mutex_t mutex;
+		std::deque<Task> tasks;
+	};
+	
+	std::vector<Worker*> workers;
+	unsigned _numThreads;
+	// wake up signalling for idle workers; generation is incremented whenever new tasks are added
+	uv_mutex_t wakeMutex;
+	uv_cond_t wakeCond;
+	unsigned generation;
+	bool exiting;
+	// number of jobs in flight; the number of threads can only be changed when this is 0
+	uv_mutex_t jobsMutex;
+	uv_cond_t jobsCond;
+	unsigned activeJobs;
+	
+	void startWorkers();
+	void stopWorkers();
+	bool getTask(Worker* worker, Task& task);
+	void completeTask(Job* job);
+	static void workerThread(void* arg);
+	
+	// disable copy constructor
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+public:
+	explicit ThreadPool(unsigned numThreads = 0);
+	~ThreadPool();
+	
+	// 0 = number of CPU threads available
+	// waits for all jobs in flight to complete before changing the number of threads
+	void setNumThreads(unsigned numThreads);
+	inline unsigned numThreads() const {
+		return _numThreads;
+	}
+	static unsigned hardwareThreads();
+	
+	// queues func to be run for every item in [0, numItems), and returns immediately; done is called once all items are complete
+	void submit(unsigned numItems, TaskFunc func, void* arg, DoneFunc done, void* doneArg);
+	// as above, but blocks until all items are complete; must not be called from within a task
+	void run(unsigned numItems, TaskFunc func, void* arg);
+};
+
+#endif
@@ -0,0 +1,57 @@
+"use strict";
+
+var gf = require('../build/Release/parpar_gf.node');
+var crypto = require('crypto');
+var assert = require('assert');
+
+// simple bytewise reference implementation
+var crcTable = [];
+for(var i=0; i<256; i++) {
+	var v = i;
+	for(var j=0; j<8; j++)
+		v = v & 1 ? (v >>> 1) ^ 0xedb88320 : v >>> 1;
+	crcTable.push(v >>> 0);
+}
+var refCrc = function(data) {
+	if(Array.isArray(data)) data = Buffer.concat(data);
+	var crc = 0xffffffff;
+	for(var i=0; i<data.length; i++)
+		crc = (crc >>> 8) ^ crcTable[(crc ^ data[i]) & 0xff];
+	crc = (crc ^ 0xffffffff) >>> 0;
+	var ret = new Buffer(4);
+	ret.writeUInt32BE(crc, 0);
+	return ret.toString('hex');
+};
+var zeroes = function(len) {
+	var b = new Buffer(len);
+	b.fill(0);
+	return b;
+};
+
+var check = function(crc, data, msg) {
+	assert.equal(crc.toString('hex'), refCrc(data), msg);
+};
+
+check(gf.crc32(new Buffer(0)), '', 'empty string');
+assert.equal(gf.crc32(new Buffer('123456789')).toString('hex'), 'cbf43926', 'check value');
+
+// cover the scalar tail, single and multi-block folding paths
+[1, 15, 16, 63, 64, 65, 255, 256, 257, 1000, 4096, 65537].forEach(function(len) {
+	var data = crypto.pseudoRandomBytes(len);
+	check(gf.crc32(data), data, 'length ' + len);
+	// unaligned
+	check(gf.crc32(data.slice(1)), data.slice(1), 'unaligned length ' + (len-1));
+
+	// incremental
+	var split = len >> 1;
+	check(gf.crc32(data.slice(split), gf.crc32(data.slice(0, split))), data, 'incremental length ' + len);
+
+	// zero extension
+	[0, 1, 100, 5000].forEach(function(zeroLen) {
+		check(gf.crc32_zeroes(gf.crc32(data), zeroLen), [data, zeroes(zeroLen)], 'zero extend ' + len + '+' + zeroLen);
+	});
+});
+
+check(gf.crc32_zeroes(gf.crc32(new Buffer(0)), 300), zeroes(300), 'zeroes only');
+
+console.log('All tests passed');
@@ -0,0 +1,213 @@
+"use strict";
+
+// checks recovery computation across all available methods against a simple reference implementation
+
+var gf = require('../build/Release/parpar_gf.node');
+var crypto = require('crypto');
+var os = require('os');
+var assert = require('assert');
+
+// reference GF16 implementation
+var POLY = 0x1100B;
+var gfExp = new Uint16Array(65535*2), gfLog = new Uint16Array(65536);
+(function() {
+	var n = 1;
+	for(var i=0; i<65535; i++) {
+		gfExp[i] = gfExp[i+65535] = n;
+		gfLog[n] = i;
+		n <<= 1;
+		if(n > 65535) n ^= POLY;
+	}
+})();
+var inputLog = [];
+(function() {
+	var e = 0;
+	for(var i=0; i<32768; i++) {
+		do {
+			e++;
+		} while(!(e%3) || !(e%5) || !(e%17) || !(e%257));
+		inputLog.push(e);
+	}
+})();
+var refGenerate = function(inputs, iNums, len, oNums) {
+	return oNums.map(function(recNum) {
+		var out = Buffer.alloc(len);
+		inputs.forEach(function(input, i) {
+			var coeffLog = (inputLog[iNums[i]] * recNum) % 65535;
+			for(var p=0; p<len; p+=2) {
+				var v = input.readUInt16LE(p);
+				if(v) out.writeUInt16LE(out.readUInt16LE(p) ^ gfExp[gfLog[v] + coeffLog], p);
+			}
+		});
+		return out;
+	});
+};
+
+var alignedBuffer = function(len, alignment, engine) {
+	var buf = Buffer.alloc(len + alignment);
+	var ao = (engine || gf).alignment_offset(buf);
+	if(ao) ao = alignment - ao;
+	return buf.slice(ao, ao + len);
+};
+
+var tests = [
+	// [numInputs, numOutputs, data length, first recovery exponent (if consecutive)]
+	[1, 1, 2],
+	[3, 5, 1000],
+	[2, 80, 5000, 0], // inputs are generated one per call, each with many outputs, so are processed input-major (pow), starting from the unit row
+	[1, 40, 3000, 7], // as above, starting from a later exponent
+	[20, 7, 70000],
+	[40, 3, 300000]
+].map(function(test) {
+	var numInputs = test[0], numOutputs = test[1], dataLen = test[2], firstExp = test[3];
+	// pad to the largest stride, so that the reference result is usable for all methods
+	var len = Math.ceil(dataLen / 256) * 256;
+	var data = [], iNums = [], oNums = [];
+	for(var i=0; i<numInputs; i++) {
+		data.push(Buffer.concat([crypto.pseudoRandomBytes(dataLen), Buffer.alloc(len - dataLen)]));
+		iNums.push((i*37 + 5) % 32768);
+	}
+	for(var i=0; i<numOutputs; i++)
+		oNums.push(firstExp === undefined ? (i*101 + i*i) % 65535 : firstExp + i);
+	return {
+		name: test.join(','),
+		dataLen: dataLen,
+		data: data,
+		iNums: iNums,
+		oNums: oNums,
+		expected: refGenerate(data, iNums, len, oNums)
+	};
+});
+
+var numMethods = 35;
+assert.equal(gf.num_methods(), numMethods);
+// run with a single thread, and with an odd number of threads to check work distribution
+[1, 3].forEach(function(threads) {
+	gf.set_max_threads(threads);
+	var methodsTested = {};
+	for(var meth=0; meth<numMethods; meth++) {
+		var info = gf.set_method(meth, 65536);
+		if(methodsTested[info.method]) continue;
+		methodsTested[info.method] = true;
+		
+		tests.forEach(function(test) {
+			var dataLen = test.dataLen, data = test.data, iNums = test.iNums, oNums = test.oNums, expected = test.expected;
+			var numInputs = data.length;
+			var msg = info.method_desc + ' (' + test.name + ', ' + threads + ' thread(s))';
+			var len = Math.ceil(dataLen / info.stride) * info.stride;
+			
+			var verify = function(outputs, type) {
+				var md5 = outputs.map(function() { return gf.md5_init(); });
+				gf.finish(outputs, dataLen, md5);
+				outputs.forEach(function(output, i) {
+					assert(output.slice(0, dataLen).equals(expected[i].slice(0, dataLen)), msg + ' ' + type + ' output ' + i);
+					assert.equal(gf.md5_final(md5[i]).toString('hex'), crypto.createHash('md5').update(expected[i].slice(0, dataLen)).digest('hex'), msg + ' ' + type + ' MD5 ' + i);
+				});
+			};
+			var newOutputs = function() {
+				return oNums.map(function() { return alignedBuffer(len, info.alignment); });
+			};
+			var half = Math.ceil(numInputs / 2);
+			
+			// unpacked inputs, split across two calls to check adding
+			var inputs = data.map(function(d) {
+				var input = alignedBuffer(len, info.alignment);
+				gf.copy(d.slice(0, dataLen), input);
+				return input;
+			});
+			var outputs = newOutputs();
+			gf.generate(inputs.slice(0, half), iNums.slice(0, half), outputs, oNums, false);
+			if(half < numInputs)
+				gf.generate(inputs.slice(half), iNums.slice(half), outputs, oNums, true);
+			verify(outputs, 'generate');
+			
+			// packed inputs; first pack is not completely filled
+			var packSize1 = half + 1;
+			var packed1 = alignedBuffer(len * packSize1, info.alignment);
+			for(var i=0; i<half; i++)
+				gf.copy_packed(data[i].slice(0, dataLen), packed1, len, i, packSize1);
+			var packSize2 = numInputs - half;
+			var packed2 = alignedBuffer(len * packSize2, info.alignment);
+			// second pack is filled via ingest_packed, which must match copy_packed, whilst also hashing the input
+			for(var i=half; i<numInputs; i++) {
+				var src = data[i].slice(0, dataLen);
+				var md5a = gf.md5_init(), md5b = gf.md5_init();
+				var crc = gf.ingest_packed(src, packed2, len, i-half, packSize2, md5a, md5b);
+				var srcMd5 = crypto.createHash('md5').update(src).digest('hex');
+				assert.equal(crc.toString('hex'), gf.crc32(src).toString('hex'), msg + ' ingest CRC ' + i);
+				assert.equal(gf.md5_final(md5a).toString('hex'), srcMd5, msg + ' ingest MD5 ' + i);
+				assert.equal(gf.md5_final(md5b).toString('hex'), srcMd5, msg + ' ingest MD5 ' + i);
+			}
+			// run twice, as coefficients are cached (and possibly pre-expanded) after first use
+			for(var round=0; round<2; round++) {
+				outputs = newOutputs();
+				gf.generate_packed(packed1, len, packSize1, iNums.slice(0, half), outputs, oNums, false);
+				if(half < numInputs)
+					gf.generate_packed(packed2, len, packSize2, iNums.slice(half), outputs, oNums, true);
+				verify(outputs, 'generate_packed');
+			}
+		});
+	}
+});
+
+// invalid method IDs must be rejected
+assert.throws(function() { gf.set_method(numMethods); });
+assert.throws(function() { gf.set_method(-1); });
+
+// the number of processors sharing the L3 can't exceed those present, and auto selection only prefers 256-bit AVX512 methods when GF isn't given all of them
+var cacheInfo = gf.set_method(0, 1048576).cache;
+assert(cacheInfo.l3_shared <= os.cpus().length, 'L3 share count ' + cacheInfo.l3_shared);
+if(cacheInfo.l3_shared > 1) {
+	var autoMethods = {
+		'Affine2x (GFNI+AVX512)': 'Affine-256 (GFNI+AVX512)',
+		'Shuffle (AVX512)': 'Shuffle-256 (AVX512)'
+	};
+	var availableDescs = gf.available_methods().map(function(meth) {
+		return gf.set_method(meth, 1048576).method_desc;
+	});
+	gf.set_max_threads(cacheInfo.l3_shared);
+	var allDesc = gf.set_method(0, 1048576).method_desc;
+	gf.set_max_threads(cacheInfo.l3_shared - 1);
+	var fewerDesc = gf.set_method(0, 1048576).method_desc;
+	var expectedDesc = availableDescs.indexOf(autoMethods[allDesc]) >= 0 ? autoMethods[allDesc] : allDesc;
+	assert.equal(fewerDesc, expectedDesc, 'auto method with fewer threads');
+	gf.set_max_threads(0);
+}
+
+// independent engines, with different methods, running jobs concurrently
+gf.set_max_threads(3);
+var methods = gf.available_methods();
+var test = tests[tests.length-1];
+var pending = 0;
+methods.slice(-2).concat([methods[0]]).forEach(function(meth) {
+	var engine = new gf.Engine();
+	var info = engine.set_method(meth, 65536);
+	var dataLen = test.dataLen, numInputs = test.data.length;
+	var len = Math.ceil(dataLen / info.stride) * info.stride;
+	var packed = alignedBuffer(len * numInputs, info.alignment, engine);
+	test.data.forEach(function(d, i) {
+		engine.copy_packed(d.slice(0, dataLen), packed, len, i, numInputs);
+	});
+	var outputs = test.oNums.map(function() { return alignedBuffer(len, info.alignment, engine); });
+	pending++;
+	engine.generate_packed(packed, len, numInputs, test.iNums, outputs, test.oNums, false, function() {
+		var md5 = outputs.map(function() { return gf.md5_init(); });
+		engine.finish(outputs, dataLen, md5, function() {
+			outputs.forEach(function(output, i) {
+				var expected = test.expected[i].slice(0, dataLen);
+				assert(output.slice(0, dataLen).equals(expected), info.method_desc + ' engine output ' + i);
+				assert.equal(gf.md5_final(md5[i]).toString('hex'), crypto.createHash('md5').update(expected).digest('hex'), info.method_desc + ' engine MD5 ' + i);
+			});
+			if(--pending == 0) {
+				gf.set_max_threads(0);
+				console.log('All tests passed');
+			}
+		});
+	});
+	// the engine can't change method whilst it's processing, but other engines can
+	assert.throws(function() { engine.set_method(meth); });
+});
+// threads are shared by all engines, so can't be changed whilst any are busy
+assert.throws(function() { gf.set_max_threads(1); });
+gf.set_method(0);
+assert.throws(function() { gf.Engine(); });
@@ -154,5 +154,58 @@ check(m, [randS2, zeroes.slice(0, 80), randM1, randM2], 'zero-bound-mix');
 check(n, [zeroes.slice(0, 20), randM2], 'zero-bound-mix');
 
 
-
-console.log('All tests passed');
+// batched updates: streams of differing lengths (including some which share a context) are packed into lanes together
+var batchCtx = [], batchData = [];
+var streams = [];
+for(var i=0; i<40; i++)
+	streams.push({ctx: gf.md5_init(i % 3 ? undefined : randS1), data: i % 3 ? [] : [randS1]});
+for(var i=0; i<150; i++) {
+	var stream = streams[(i * 7) % (i < 100 ? 40 : 3)];
+	var data = [randS1, randM2, randL1, zeroes, Buffer(''), crypto.pseudoRandomBytes(i * 397)][i % 6];
+	batchCtx.push(stream.ctx);
+	batchData.push(data);
+	stream.data.push(data);
+}
+var checkBatch = function(msg) {
+	streams.forEach(function(stream, i) {
+		check(stream.ctx, stream.data, msg + ' ' + i);
+	});
+};
+// CRC32s can be requested for any of the buffers
+var batchCrcs;
+var newBatchCrcs = function(every) {
+	batchCrcs = batchData.map(function(data, i) {
+		return i % every ? null : new Buffer(4);
+	});
+};
+var checkBatchCrcs = function(msg) {
+	batchCrcs.forEach(function(crc, i) {
+		if(crc) assert.equal(crc.toString('hex'), gf.crc32(batchData[i]).toString('hex'), msg + ' CRC32 ' + i);
+	});
+};
+newBatchCrcs(2);
+gf.md5_update_batch(batchCtx, batchData, null, batchCrcs);
+checkBatch('batch');
+checkBatchCrcs('batch');
+
+// on the thread pool, with each context appearing twice
+batchCtx = [];
+batchData = [];
+streams.forEach(function(stream) {
+	stream.ctx = gf.md5_init();
+	stream.data = [Buffer.concat(stream.data), randM1];
+	batchCtx.push(stream.ctx);
+	batchData.push(stream.data[0]);
+});
+streams.forEach(function(stream) {
+	batchCtx.push(stream.ctx);
+	batchData.push(stream.data[1]);
+});
+gf.set_max_threads(3);
+newBatchCrcs(1);
+gf.md5_update_batch(batchCtx, batchData, function() {
+	checkBatch('async batch');
+	checkBatchCrcs('async batch');
+	gf.set_max_threads(0);
+	console.log('All tests passed');
+}, batchCrcs);
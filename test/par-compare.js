@@ -228,6 +228,7 @@ function parpar_args(o) {
 	// ParPar only tests
 	if(o.memory) a.push('-m'+o.memory);
 	if(o.chunk) a.push('--min-chunk-size='+o.chunk);
+	if(o.readConcurrency) a.push('--read-concurrency='+o.readConcurrency);
 	//if(o.seqFirst) a.push('--seq-first-pass');
 	
 	return a.concat(['-o', o.out], o.in);
@@ -401,6 +402,15 @@ var allTests = [
 		singleFile: true,
 		cacheKey: '7'
 	},
+	{ // as above, but with several files read (and hashed) at once
+		in: [tmpDir + 'test1b.bin', tmpDir + 'test8b.bin', tmpDir + 'test13m.bin', tmpDir + 'test65k.bin'],
+		blockSize: 12224,
+		blocks: 113,
+		offset: 7,
+		singleFile: true,
+		parpar: {readConcurrency: 3},
+		cacheKey: '7'
+	},
 	{
 		in: [tmpDir + 'test1b.bin', tmpDir + 'test8b.bin'],
 		blockSize: 8,